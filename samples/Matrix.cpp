@@ -1,15 +1,32 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "Matrix.h"
+#include <algorithm>
+#include <math.h>
+#include <thread>
+#include <charconv>
+#include <unordered_set>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include <fstream>
 #include <iostream>
 
 using namespace std;
 Matrix :: Matrix (int _rows, int _cols)
 {
-  //can either use new (adds to heap) or malloc. Using new.
+  allocate(_rows, _cols);
+}
+
+//can either use new (adds to heap) or malloc. Using new.
+void Matrix::allocate (int _rows, int _cols)
+{
   rows = _rows;
   cols = _cols;
+  sums = NULL;
   
   data = new float*[rows];
   
@@ -19,6 +36,60 @@ Matrix :: Matrix (int _rows, int _cols)
     }
 }
 
+void Matrix::release ()
+{
+  for (int i = 0; i < rows; i ++)
+    delete [] data[i];
+  delete [] data;
+  delete sums;
+  data = NULL;
+  sums = NULL;
+}
+
+Matrix::~Matrix ()
+{
+  release();
+}
+
+void Matrix::shapeError (const char *op, int rows1, int cols1,
+                         int rows2, int cols2)
+{
+  std::cerr << "cannot apply " << op << " to a " << rows1 << " x " << cols1
+            << " matrix and a " << rows2 << " x " << cols2 << " matrix"
+            << std::endl;
+  exit(1);
+}
+
+void CheckedAccess::boundsError(int i, int j, int rows, int cols,
+                                int line, const char *text)
+{
+  if (line > 0)
+    std::cerr << "line " << line << ": ";
+  std::cerr << "index (" << i << ", " << j << ") out of bounds in " << text
+            << " for a " << rows << " x " << cols << " matrix" << std::endl;
+  exit(1);
+}
+
+void CheckedAccess::boundsError(int i, int j, int k, const int *extents,
+                                int line, const char *text)
+{
+  if (line > 0)
+    std::cerr << "line " << line << ": ";
+  std::cerr << "index (" << i << ", " << j << ", " << k << ") out of bounds in "
+            << text << " for a " << extents[0] << " x " << extents[1] << " x "
+            << extents[2] << " cube" << std::endl;
+  exit(1);
+}
+
+void CheckedAccess::axisError(int axis, int line, const char *text)
+{
+  if (line > 0)
+    std::cerr << "line " << line << ": ";
+  std::cerr << "axis " << axis << " out of bounds in " << text
+            << " for a cube, whose axes are 0, 1 and 2" << std::endl;
+  exit(1);
+}
+
 int Matrix::numRows ( )
 {
 	  return rows;
@@ -43,14 +114,14 @@ float* Matrix::access(const int i, const int j) const
        matrix, similar to toString()
 }
 */
-std::ostream& operator<<(std::ostream &os, Matrix &m)
+std::ostream& operator<<(std::ostream &os, const Matrix &m)
 {
-  os << m.numRows() << " " << m.numCols() << std::endl;
+  os << m.rows << " " << m.cols << std::endl;
   
   
-  for (int i = 0; i < m.numRows(); i++)
+  for (int i = 0; i < m.rows; i++)
 	  {
-		for (int j = 0; j < m.numCols(); j++)
+		for (int j = 0; j < m.cols; j++)
 		{
 			os << *(m.access(i,j)) << "  ";	//must be a pointer to where the address points to?? does this apply for ifstream
 		}
@@ -60,6 +131,206 @@ std::ostream& operator<<(std::ostream &os, Matrix &m)
   return os;
 }
 
+Printer fcalOut(1, Printer::formatFromEnvironment());
+
+Printer::Printer (int _fd, Format _format)
+  : fd(_fd), format(_format), used(0), capacity(1 << 20)
+{
+  buffer = new char[capacity];
+}
+
+Printer::~Printer ()
+{
+  flush();
+  delete [] buffer;
+}
+
+Printer::Format Printer::formatFromEnvironment ()
+{
+  const char *env = getenv("FCAL_PRINT");
+  if (env && strcmp(env, "shortest") == 0)
+    return Shortest;
+  if (env && strcmp(env, "binary") == 0)
+    return Binary;
+  return Text;
+}
+
+bool Printer::flush ()
+{
+  size_t done = 0;
+  while (done < used)
+    {
+      ssize_t n = write(fd, buffer + done, used - done);
+      if (n <= 0)
+        break;
+      done += n;
+    }
+  bool ok = done == used;
+  used = 0;
+  return ok;
+}
+
+char *Printer::reserve (size_t n)
+{
+  if (used + n > capacity)
+    flush();
+  return buffer + used;
+}
+
+void Printer::put (const char *s, size_t n)
+{
+  if (n > capacity)
+    {
+      flush();
+      while (n > 0)
+        {
+          ssize_t w = write(fd, s, n);
+          if (w <= 0)
+            return;
+          s += w;
+          n -= w;
+        }
+      return;
+    }
+  memcpy(reserve(n), s, n);
+  used += n;
+}
+
+Printer& Printer::operator<< (int v)
+{
+  char *p = reserve(16);
+  used = std::to_chars(p, p + 16, v).ptr - buffer;
+  return *this;
+}
+
+Printer& Printer::operator<< (long v)
+{
+  char *p = reserve(24);
+  used = std::to_chars(p, p + 24, v).ptr - buffer;
+  return *this;
+}
+
+/* std::cout prints floats as doubles, with %g. */
+Printer& Printer::operator<< (float v)
+{
+  if (format == Text)
+    return *this << (double) v;
+  char *p = reserve(32);
+  used = std::to_chars(p, p + 32, v).ptr - buffer;
+  return *this;
+}
+
+Printer& Printer::operator<< (double v)
+{
+  char *p = reserve(32);
+  if (format == Text)
+    used = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - buffer;
+  else
+    used = std::to_chars(p, p + 32, v).ptr - buffer;
+  return *this;
+}
+
+Printer& Printer::operator<< (const char *s)
+{
+  put(s, strlen(s));
+  return *this;
+}
+
+Printer& Printer::operator<< (const std::string &s)
+{
+  put(s.data(), s.size());
+  return *this;
+}
+
+Printer& Printer::operator<< (const Matrix &m)
+{
+  if (format == Binary)
+    {
+      int size[2] = { m.rows, m.cols };
+      put("FCM1", 4);
+      put((const char *) size, sizeof(size));
+      for (int i = 0; i < m.rows; i++)
+        put((const char *) m.data[i], m.cols * sizeof(float));
+      return *this;
+    }
+  *this << m.rows << " " << m.cols << "\n";
+  for (int i = 0; i < m.rows; i++)
+    {
+      for (int j = 0; j < m.cols; j++)
+        *this << m.data[i][j] << "  ";
+      put("\n", 1);
+    }
+  return *this;
+}
+
+Printer& Printer::operator<< (const Mask &m)
+{
+  if (format == Binary)
+    {
+      int size[2] = { m.rows, m.cols };
+      put("FCM1", 4);
+      put((const char *) size, sizeof(size));
+      std::vector<float> row(m.cols);
+      for (int i = 0; i < m.rows; i++)
+        {
+          for (int j = 0; j < m.cols; j++)
+            row[j] = *m.access(i, j) ? 1.0f : 0.0f;
+          put((const char *) row.data(), m.cols * sizeof(float));
+        }
+      return *this;
+    }
+  *this << m.rows << " " << m.cols << "\n";
+  for (int i = 0; i < m.rows; i++)
+    {
+      for (int j = 0; j < m.cols; j++)
+        put(*m.access(i, j) ? "1  " : "0  ", 3);
+      put("\n", 1);
+    }
+  return *this;
+}
+
+Printer& Printer::operator<< (const Cube &c)
+{
+  *this << c.extents[0] << " " << c.extents[1] << " " << c.extents[2] << "\n";
+  for (int i = 0; i < c.extents[0]; i++)
+    {
+      for (int j = 0; j < c.extents[1]; j++)
+        {
+          for (int k = 0; k < c.extents[2]; k++)
+            *this << *c.access(i, j, k) << "  ";
+          put("\n", 1);
+        }
+      put("\n", 1);
+    }
+  return *this;
+}
+
+Printer& Printer::operator<< (const SparseMatrix &m)
+{
+  std::vector<float> row(m.cols);
+  if (format == Binary)
+    {
+      int size[2] = { m.rows, m.cols };
+      put("FCM1", 4);
+      put((const char *) size, sizeof(size));
+      for (int i = 0; i < m.rows; i++)
+        {
+          m.expandRow(i, row.data());
+          put((const char *) row.data(), m.cols * sizeof(float));
+        }
+      return *this;
+    }
+  *this << m.rows << " " << m.cols << "\n";
+  for (int i = 0; i < m.rows; i++)
+    {
+      m.expandRow(i, row.data());
+      for (int j = 0; j < m.cols; j++)
+        *this << row[j] << "  ";
+      put("\n", 1);
+    }
+  return *this;
+}
+
 Matrix Matrix::readMatrix (std::string filename)
 {
   int row; 
@@ -76,7 +347,42 @@ Matrix Matrix::readMatrix (std::string filename)
   
   if (fin.is_open())
     {
+	  fin.seekg(0, std::ios::end);
+	  long bytes = fin.tellg();
+	  fin.seekg(0);
+	  char magic[4];
+	  fin.read(magic, 4);
+	  if (fin.gcount() == 4 && memcmp(magic, "FCM1", 4) == 0)
+	    {
+	      int size[2];
+	      fin.read((char *) size, sizeof(size));
+	      /* The cells must fit in what is left of the file. */
+	      if (!fin || size[0] < 0 || size[1] < 0
+		  || (size[0] > 0 && (long) size[1] > (bytes - 12) / (long) sizeof(float) / size[0]))
+		{
+		  std::cerr << "Bad matrix file : " << filename << std::endl;
+		  exit(1);
+		}
+	      Matrix m = Matrix (size[0], size[1]);
+	      for (int i = 0; i < m.rows && fin; i++)
+		fin.read((char *) m.data[i], m.cols * sizeof(float));
+	      if (!fin)
+		{
+		  std::cerr << "Truncated matrix file : " << filename << std::endl;
+		  exit(1);
+		}
+	      return m;
+	    }
+	  fin.clear();
+	  fin.seekg(0);
+
 	  fin >> row >> col;
+	  /* Every cell takes at least one character. */
+	  if (!fin || row < 0 || col < 0 || (row > 0 && col > bytes / row))
+	    {
+	      std::cerr << "Bad matrix file : " << filename << std::endl;
+	      exit(1);
+	    }
 	  Matrix m = Matrix (row, col);
       for (int i = 0; i < m.numRows(); i++)
 	  {
@@ -93,22 +399,36 @@ Matrix Matrix::readMatrix (std::string filename)
     else 
 	{
 		std::cout << "READ FAIL" << std::endl;
+		exit(1);
 	}
 }
 
+void Matrix::writeMatrix (const Matrix &m, std::string filename)
+{
+  int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    {
+      std::cerr << "Failed to create file : " << filename << std::endl;
+      exit(1);
+    }
+  bool ok;
+  {
+    Printer out(fd, Printer::Binary);
+    out << m;
+    ok = out.flush();
+  }
+  if (close(fd) != 0 || !ok)
+    {
+      std::cerr << "Failed to write file : " << filename << std::endl;
+      exit(1);
+    }
+}
+
 Matrix::Matrix (const Matrix& m)
 {
 	//we need to perform deep copy or else it will print uninitialized values
 	// previous error was due to declaring an int, which would allocate new memory for that int. making anther int not initialized
-	rows = m.rows;
-	cols = m.cols;
-	 
-	data = new float*[rows];
-  
-	for (int i = 0; i < rows; i ++)
-    {
-		data[i] = new float[cols];
-    }
+	allocate(m.rows, m.cols);
     
     for (int j = 0; j < rows; j++)
 	  {
@@ -119,9 +439,802 @@ Matrix::Matrix (const Matrix& m)
 	  }
     
 }
+
+Matrix& Matrix::operator= (const Matrix& m)
+{
+  if (this == &m)
+    return *this;
+  release();
+  allocate(m.rows, m.cols);
+  for (int j = 0; j < rows; j++)
+    for (int k = 0; k < cols; k++)
+      data[j][k] = m.data[j][k];
+  return *this;
+}
+
+const SummedAreaTable& Matrix::prefixSums ()
+{
+  if (sums == NULL)
+    sums = new SummedAreaTable(*this);
+  return *sums;
+}
+
+double SummedAreaTable::rect (int r0, int r1, int c0, int c1) const
+{
+  if (r0 < 0) r0 = 0;
+  if (c0 < 0) c0 = 0;
+  if (r1 > rows - 1) r1 = rows - 1;
+  if (c1 > cols - 1) c1 = cols - 1;
+  if (r0 > r1 || c0 > c1)
+    return 0.0;
+  int width = cols + 1;
+  return sums[(r1 + 1) * width + c1 + 1] - sums[r0 * width + c1 + 1]
+       - sums[(r1 + 1) * width + c0] + sums[r0 * width + c0];
+}
+
+/* c[j] += a * b[j] for j < n, in blocks of eight so that it vectorizes. */
+static void axpy (float *__restrict c, const float *__restrict b, float a, int n)
+{
+  int j = 0;
+  for (; j + 8 <= n; j += 8)
+    for (int l = 0; l < 8; l++)
+      c[j + l] += a * b[j + l];
+  for (; j < n; j++)
+    c[j] += a * b[j];
+}
+
+/* multiplyAdd for rows i0 to i1 of c.  The k and j ranges are cut into
+   blocks of kBlock x jBlock floats of b; the k blocks are visited in
+   increasing order, so each c[i][j] sums in increasing k. */
+static void multiplyRows (float **c, float **a, float **b, int i0, int i1,
+                          int j0, int j1, int k0, int k1)
+{
+  const int kBlock = 128, jBlock = 512;
+  for (int kk = k0; kk <= k1; kk += kBlock)
+    for (int jj = j0; jj <= j1; jj += jBlock)
+      {
+        int kEnd = std::min(kk + kBlock - 1, k1);
+        int n = std::min(jj + jBlock - 1, j1) - jj + 1;
+        for (int i = i0; i <= i1; i++)
+          for (int k = kk; k <= kEnd; k++)
+            axpy(c[i] + jj, b[k] + jj, a[i][k], n);
+      }
+}
+
+int fcalThreads ()
+{
+  static int threads = 0;
+  if (threads == 0)
+    {
+      const char *env = getenv("FCAL_THREADS");
+      threads = env ? atoi(env) : 1;
+      if (threads < 1)
+        threads = 1;
+    }
+  return threads;
+}
+
+static int tileUsage (const char *prog)
+{
+  std::cerr << "Usage: " << prog
+            << " [-j jobs] [--memory bytes] [--output dir] [--list file] tile ..."
+            << std::endl;
+  return 2;
+}
+
+/* Runs program(tile) in a child process writing its print output to out. */
+static pid_t startTile (void (*program) (std::string), const string &tile, const string &out)
+{
+  pid_t pid = fork();
+  if (pid != 0)
+    return pid;
+  int fd = open(out.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    {
+      std::cerr << "Failed to create file : " << out << std::endl;
+      _exit(1);
+    }
+  dup2(fd, 1);
+  close(fd);
+  program(tile);
+  bool ok = fcalOut.flush();
+  std::cout.flush();
+  _exit(ok ? 0 : 1);
+}
+
+int runTiles (int argc, char **argv, void (*program) (std::string))
+{
+  long jobs = sysconf(_SC_NPROCESSORS_ONLN) / fcalThreads();
+  double budget = (double) sysconf(_SC_PHYS_PAGES) * sysconf(_SC_PAGESIZE) / 2;
+  string outDir;
+  vector<string> tiles;
+  for (int i = 1; i < argc; i++)
+    {
+      string arg(argv[i]);
+      bool hasValue = i + 1 < argc;
+      if (arg == "-j" && hasValue)
+        jobs = atol(argv[++i]);
+      else if (arg == "--memory" && hasValue)
+        budget = atof(argv[++i]);
+      else if (arg == "--output" && hasValue)
+        outDir = argv[++i];
+      else if (arg == "--list" && hasValue)
+        {
+          std::ifstream list(argv[++i]);
+          if (!list)
+            {
+              std::cerr << "Failed to open file : " << argv[i] << std::endl;
+              return 2;
+            }
+          string tile;
+          while (std::getline(list, tile))
+            if (!tile.empty())
+              tiles.push_back(tile);
+        }
+      else if (arg[0] != '-')
+        tiles.push_back(arg);
+      else
+        return tileUsage(argv[0]);
+    }
+  if (tiles.empty())
+    return tileUsage(argv[0]);
+  if (jobs < 1)
+    jobs = 1;
+
+  struct Running { pid_t pid; size_t tile; double estimate; };
+  vector<Running> running;
+  vector<double> sizes(tiles.size(), 0);
+  double ratio = 8, inUse = 0;
+  size_t next = 0;
+  int failed = 0;
+  for (size_t t = 0; t < tiles.size(); t++)
+    {
+      struct stat st;
+      if (stat(tiles[t].c_str(), &st) == 0)
+        sizes[t] = st.st_size;
+    }
+  std::cout.flush();
+  fcalOut.flush();
+  while (next < tiles.size() || !running.empty())
+    {
+      while (next < tiles.size() && (long) running.size() < jobs
+             && (running.empty() || inUse + sizes[next] * ratio <= budget))
+        {
+          const string &tile = tiles[next];
+          string out = tile + ".out";
+          if (!outDir.empty())
+            out = outDir + "/" + tile.substr(tile.find_last_of('/') + 1) + ".out";
+          pid_t pid = startTile(program, tile, out);
+          if (pid < 0)
+            {
+              std::cerr << tile << ": cannot start a process" << std::endl;
+              failed++;
+            }
+          else
+            {
+              Running r = { pid, next, sizes[next] * ratio };
+              running.push_back(r);
+              inUse += r.estimate;
+            }
+          next++;
+        }
+      if (running.empty())
+        continue;
+
+      int status;
+      struct rusage usage;
+      pid_t pid = wait4(-1, &status, 0, &usage);
+      if (pid < 0)
+        break;
+      for (size_t k = 0; k < running.size(); k++)
+        {
+          if (running[k].pid != pid)
+            continue;
+          size_t t = running[k].tile;
+          inUse -= running[k].estimate;
+          running.erase(running.begin() + k);
+          /* ru_maxrss is in kilobytes. */
+          if (sizes[t] >= (1 << 20))
+            ratio = std::max(ratio, usage.ru_maxrss * 1024.0 / sizes[t]);
+          if (WIFEXITED(status) && WEXITSTATUS(status) == 0)
+            break;
+          failed++;
+          if (WIFEXITED(status))
+            std::cerr << tiles[t] << ": failed with exit status " << WEXITSTATUS(status) << std::endl;
+          else
+            std::cerr << tiles[t] << ": killed by signal " << WTERMSIG(status) << std::endl;
+          break;
+        }
+    }
+  if (!running.empty())
+    {
+      std::cerr << "lost track of " << running.size() << " tiles" << std::endl;
+      failed += running.size();
+    }
+  return failed == 0 ? 0 : 1;
+}
+
+void Matrix::multiplyAdd (Matrix &c, const Matrix &a, const Matrix &b,
+                          int i0, int i1, int j0, int j1, int k0, int k1)
+{
+  if (i0 > i1 || j0 > j1 || k0 > k1)
+    return;
+  int threads = fcalThreads();
+  double work = (double) (i1 - i0 + 1) * (j1 - j0 + 1) * (k1 - k0 + 1);
+  if (threads > i1 - i0 + 1)
+    threads = i1 - i0 + 1;
+  if (threads == 1 || work < 1e6)
+    {
+      multiplyRows(c.data, a.data, b.data, i0, i1, j0, j1, k0, k1);
+      return;
+    }
+  std::vector<std::thread> pool;
+  int rows = i1 - i0 + 1;
+  for (int t = 0; t < threads; t++)
+    {
+      int first = i0 + (long) rows * t / threads;
+      int last = i0 + (long) rows * (t + 1) / threads - 1;
+      pool.push_back(std::thread(multiplyRows, c.data, a.data, b.data,
+                                 first, last, j0, j1, k0, k1));
+    }
+  for (size_t t = 0; t < pool.size(); t++)
+    pool[t].join();
+}
+
+Matrix Matrix::multiply (const Matrix &a, const Matrix &b)
+{
+  if (a.cols != b.rows)
+    {
+      std::cerr << "matmul: cannot multiply a " << a.rows << " x " << a.cols
+                << " matrix by a " << b.rows << " x " << b.cols << " matrix"
+                << std::endl;
+      exit(1);
+    }
+  Matrix c(a.rows, b.cols);
+  for (int i = 0; i < c.rows; i++)
+    std::fill(c.data[i], c.data[i] + c.cols, 0.0f);
+  multiplyAdd(c, a, b, 0, a.rows - 1, 0, b.cols - 1, 0, a.cols - 1);
+  return c;
+}
+
+/* Clips columns c0 to c1 of row i to the matrix; n is 0 when empty. */
+static const float *rowSpan (float **data, int cols, int i, int c0, int c1,
+                             int &n)
+{
+  if (c0 < 0) c0 = 0;
+  if (c1 > cols - 1) c1 = cols - 1;
+  n = c1 < c0 ? 0 : c1 - c0 + 1;
+  return n > 0 ? data[i] + c0 : NULL;
+}
+
+double Matrix::rowSum (int i, int c0, int c1) const
+{
+  int n;
+  const float *a = rowSpan(data, cols, i, c0, c1, n);
+  return sumKernel(a, n);
+}
+
+float Matrix::rowMax (int i, int c0, int c1, float init) const
+{
+  int n;
+  const float *a = rowSpan(data, cols, i, c0, c1, n);
+  return maxKernel(a, n, init);
+}
+
+float Matrix::rowMin (int i, int c0, int c1, float init) const
+{
+  int n;
+  const float *a = rowSpan(data, cols, i, c0, c1, n);
+  return minKernel(a, n, init);
+}
+
+double sumKernel (const float *a, int n)
+{
+  double lanes[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+    for (int l = 0; l < 8; l++)
+      lanes[l] += a[i + l];
+  double s = 0;
+  for (int l = 0; l < 8; l++)
+    s += lanes[l];
+  for (; i < n; i++)
+    s += a[i];
+  return s;
+}
+
+float maxKernel (const float *a, int n, float init)
+{
+  float lanes[8] = { init, init, init, init, init, init, init, init };
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+    for (int l = 0; l < 8; l++)
+      lanes[l] = lanes[l] < a[i + l] ? a[i + l] : lanes[l];
+  float m = init;
+  for (int l = 0; l < 8; l++)
+    m = m < lanes[l] ? lanes[l] : m;
+  for (; i < n; i++)
+    m = m < a[i] ? a[i] : m;
+  return m;
+}
+
+float minKernel (const float *a, int n, float init)
+{
+  float lanes[8] = { init, init, init, init, init, init, init, init };
+  int i = 0;
+  for (; i + 8 <= n; i += 8)
+    for (int l = 0; l < 8; l++)
+      lanes[l] = a[i + l] < lanes[l] ? a[i + l] : lanes[l];
+  float m = init;
+  for (int l = 0; l < 8; l++)
+    m = lanes[l] < m ? lanes[l] : m;
+  for (; i < n; i++)
+    m = a[i] < m ? a[i] : m;
+  return m;
+}
+
+TriangularMatrix::TriangularMatrix (int _rows, int _cols, Half half, int shift,
+                                    float fill, bool _symmetric)
+  : rows(_rows), cols(_cols), symmetric(_symmetric), fillCell(fill), sums(NULL)
+{
+  first = new int[rows];
+  last = new int[rows];
+  offset = new long[rows];
+  long stored = 0;
+  for (int i = 0; i < rows; i++)
+    {
+      first[i] = half == Upper ? std::max(0, i + shift) : 0;
+      last[i] = half == Upper ? cols - 1 : std::min(cols - 1, i - shift);
+      offset[i] = stored - first[i];
+      if (last[i] >= first[i])
+        stored += last[i] - first[i] + 1;
+    }
+  cells = new float[stored > 0 ? stored : 1];
+}
+
+TriangularMatrix::~TriangularMatrix ()
+{
+  delete [] first;
+  delete [] last;
+  delete [] offset;
+  delete [] cells;
+  delete sums;
+}
+
+int TriangularMatrix::numRows ( )
+{
+  return rows;
+}
+
+int TriangularMatrix::numCols ( )
+{
+  return cols;
+}
+
+const SummedAreaTable& TriangularMatrix::prefixSums ()
+{
+  if (sums == NULL)
+    sums = new SummedAreaTable(*this);
+  return *sums;
+}
+
+/* Clips columns c0 to c1 of row i to the matrix, and splits them into
+   the stored run s0 to s1 (empty when s0 > s1) and the others. */
+void TriangularMatrix::split (int i, int &c0, int &c1, int &s0, int &s1) const
+{
+  if (c0 < 0) c0 = 0;
+  if (c1 > cols - 1) c1 = cols - 1;
+  s0 = std::max(c0, first[i]);
+  s1 = std::min(c1, last[i]);
+}
+
+double TriangularMatrix::rowSum (int i, int c0, int c1) const
+{
+  int s0, s1;
+  split(i, c0, c1, s0, s1);
+  if (c0 > c1)
+    return 0.0;
+  double s = s0 <= s1 ? sumKernel(cells + offset[i] + s0, s1 - s0 + 1) : 0.0;
+  int outside = (c1 - c0 + 1) - (s0 <= s1 ? s1 - s0 + 1 : 0);
+  if (!symmetric)
+    return s + (double) fillCell * outside;
+  for (int j = c0; j <= c1; j++)
+    if (j < s0 || j > s1)
+      s += *access(i, j);
+  return s;
+}
+
+float TriangularMatrix::rowMax (int i, int c0, int c1, float init) const
+{
+  int s0, s1;
+  split(i, c0, c1, s0, s1);
+  float m = s0 <= s1 ? maxKernel(cells + offset[i] + s0, s1 - s0 + 1, init) : init;
+  for (int j = c0; j <= c1; j++)
+    if (j < s0 || j > s1)
+      {
+        float v = *access(i, j);
+        m = m < v ? v : m;
+        if (!symmetric)
+          break;
+      }
+  return m;
+}
+
+float TriangularMatrix::rowMin (int i, int c0, int c1, float init) const
+{
+  int s0, s1;
+  split(i, c0, c1, s0, s1);
+  float m = s0 <= s1 ? minKernel(cells + offset[i] + s0, s1 - s0 + 1, init) : init;
+  for (int j = c0; j <= c1; j++)
+    if (j < s0 || j > s1)
+      {
+        float v = *access(i, j);
+        m = v < m ? v : m;
+        if (!symmetric)
+          break;
+      }
+  return m;
+}
+
 /*
 //helpful: http://www.augustcouncil.com/~tgibson/tutorial/iotips.html
 // http://stackoverflow.com/questions/15588800/reading-matrix-from-a-text-file-to-2d-integer-array-c
 // http://www2.lawrence.edu/fast/GREGGJ/CMSC110/dynamic/dynamic_arrays.html
   
 */
+
+/* Folds n contiguous cells, sums and maxima through the kernels. */
+static double foldCells (const float *a, int n, Matrix::FoldOp op)
+{
+  switch (op)
+    {
+    case Matrix::FoldSum: return sumKernel(a, n);
+    case Matrix::FoldMax: return n > 0 ? maxKernel(a, n, a[0]) : -HUGE_VAL;
+    case Matrix::FoldMin: return n > 0 ? minKernel(a, n, a[0]) : HUGE_VAL;
+    default:
+      {
+        double p = 1.0;
+        for (int j = 0; j < n; j++)
+          p *= a[j];
+        return p;
+      }
+    }
+}
+
+/* Per-row partial results of folding m, computed in parallel. */
+static std::vector<double> foldPartials (float **data, int rows, int cols,
+                                         Matrix::FoldOp op)
+{
+  std::vector<double> partials(rows);
+  parallelRanges(rows, (long) rows * cols, true, [&] (int i0, int i1) {
+      for (int i = i0; i < i1; i++)
+        partials[i] = foldCells(data[i], cols, op);
+    });
+  return partials;
+}
+
+/* The row partials are combined in a fixed tree, so that the result
+   is the same for any number of threads. */
+float Matrix::fold (const Matrix &m, FoldOp op)
+{
+  std::vector<double> partials = foldPartials(m.data, m.rows, m.cols, op);
+  if (m.cols == 0)
+    partials.clear();
+  return combinePartials(partials, reductionIdentity<double>(op), op);
+}
+
+Matrix Matrix::foldRows (const Matrix &m, FoldOp op)
+{
+  std::vector<double> partials = foldPartials(m.data, m.rows, m.cols, op);
+  Matrix r(m.rows, 1);
+  for (int i = 0; i < m.rows; i++)
+    r.data[i][0] = m.cols > 0 ? partials[i] : reductionIdentity<double>(op);
+  return r;
+}
+
+/* Folds down the columns a row at a time, so that the inner loop runs
+   along a row and vectorizes; column ranges are shared out over the
+   threads. */
+Matrix Matrix::foldCols (const Matrix &m, FoldOp op)
+{
+  std::vector<double> acc(m.cols, reductionIdentity<double>(op));
+  parallelRanges(m.cols, (long) m.rows * m.cols, true, [&] (int j0, int j1) {
+      for (int i = 0; i < m.rows; i++)
+        {
+          const float *row = m.data[i];
+          for (int j = j0; j < j1; j++)
+            acc[j] = reductionCombine<double>(acc[j], row[j], op);
+        }
+    });
+  Matrix r(1, m.cols);
+  for (int j = 0; j < m.cols; j++)
+    r.data[0][j] = acc[j];
+  return r;
+}
+
+Mask::Mask (int _rows, int _cols)
+  : rows(_rows), cols(_cols), stride((_cols + 63) / 64),
+    words((size_t) _rows * stride, 0)
+{
+}
+
+Mask::Mask (const Matrix &m)
+  : rows(m.rows), cols(m.cols), stride((m.cols + 63) / 64),
+    words((size_t) m.rows * stride, 0)
+{
+  fill(MatrixOperand(m));
+}
+
+/* Bits set in w, added up in ever wider fields.  Unlike
+   __builtin_popcountll without -mpopcnt this is no library call, so
+   the loop in count vectorizes. */
+static inline uint64_t popcount64 (uint64_t w)
+{
+  w = w - ((w >> 1) & 0x5555555555555555ULL);
+  w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+  w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return (w * 0x0101010101010101ULL) >> 56;
+}
+
+long Mask::count () const
+{
+  uint64_t n = 0;
+  for (size_t k = 0; k < words.size(); k++)
+    n += popcount64(words[k]);
+  return n;
+}
+
+Mask operator&& (const Mask &a, const Mask &b)
+{
+  if (a.rows != b.rows || a.cols != b.cols)
+    Matrix::shapeError("&&", a.rows, a.cols, b.rows, b.cols);
+  Mask r(a.rows, a.cols);
+  for (size_t k = 0; k < r.words.size(); k++)
+    r.words[k] = a.words[k] & b.words[k];
+  return r;
+}
+
+Mask operator|| (const Mask &a, const Mask &b)
+{
+  if (a.rows != b.rows || a.cols != b.cols)
+    Matrix::shapeError("||", a.rows, a.cols, b.rows, b.cols);
+  Mask r(a.rows, a.cols);
+  for (size_t k = 0; k < r.words.size(); k++)
+    r.words[k] = a.words[k] | b.words[k];
+  return r;
+}
+
+/* The bits past the last column of a row stay clear. */
+Mask operator! (const Mask &a)
+{
+  Mask r(a.rows, a.cols);
+  uint64_t last = a.cols % 64 ? ((uint64_t) 1 << (a.cols % 64)) - 1 : ~(uint64_t) 0;
+  for (size_t k = 0; k < r.words.size(); k++)
+    r.words[k] = ~a.words[k];
+  if (a.stride > 0)
+    for (int i = 0; i < a.rows; i++)
+      r.words[(size_t) i * a.stride + a.stride - 1] &= last;
+  return r;
+}
+
+std::ostream& operator<< (std::ostream &os, const Mask &m)
+{
+  os << m.rows << " " << m.cols << std::endl;
+  for (int i = 0; i < m.rows; i++)
+    {
+      for (int j = 0; j < m.cols; j++)
+        os << (*m.access(i, j) ? 1 : 0) << "  ";
+      os << std::endl;
+    }
+  return os;
+}
+
+Cube::Cube (int d0, int d1, int d2, Layout _layout)
+  : order(_layout), cells(NULL)
+{
+  extents[0] = d0;
+  extents[1] = d1;
+  extents[2] = d2;
+  allocate();
+}
+
+Cube::Cube (const Cube &c)
+  : order(c.order), cells(NULL)
+{
+  for (int axis = 0; axis < 3; axis++)
+    extents[axis] = c.extents[axis];
+  allocate();
+  memcpy(cells, c.cells, (size_t) extents[0] * extents[1] * extents[2] * sizeof(float));
+}
+
+Cube& Cube::operator= (const Cube &c)
+{
+  if (this == &c)
+    return *this;
+  delete [] cells;
+  order = c.order;
+  for (int axis = 0; axis < 3; axis++)
+    extents[axis] = c.extents[axis];
+  allocate();
+  memcpy(cells, c.cells, (size_t) extents[0] * extents[1] * extents[2] * sizeof(float));
+  return *this;
+}
+
+Cube::~Cube ()
+{
+  delete [] cells;
+}
+
+void Cube::shapeError (int rows, int cols, int d0, int d1, int d2)
+{
+  std::cerr << "cannot read a " << rows << " x " << cols << " matrix as a "
+            << d0 << " x " << d1 << " x " << d2 << " cube" << std::endl;
+  exit(1);
+}
+
+/* Zeroed cells, and the strides of the layout. */
+void Cube::allocate ()
+{
+  if (order == LastFastest)
+    {
+      strides[2] = 1;
+      strides[1] = extents[2];
+      strides[0] = (long) extents[1] * extents[2];
+    }
+  else
+    {
+      strides[0] = 1;
+      strides[1] = extents[0];
+      strides[2] = (long) extents[0] * extents[1];
+    }
+  cells = new float[(size_t) extents[0] * extents[1] * extents[2]]();
+}
+
+std::ostream& operator<< (std::ostream &os, const Cube &c)
+{
+  os << c.extents[0] << " " << c.extents[1] << " " << c.extents[2] << std::endl;
+  for (int i = 0; i < c.extents[0]; i++)
+    {
+      for (int j = 0; j < c.extents[1]; j++)
+        {
+          for (int k = 0; k < c.extents[2]; k++)
+            os << *c.access(i, j, k) << "  ";
+          os << std::endl;
+        }
+      os << std::endl;
+    }
+  return os;
+}
+
+SparseMatrix::SparseMatrix (int _rows, int _cols)
+  : rows(_rows), cols(_cols), starts(_rows + 1, 0)
+{
+}
+
+const float *SparseMatrix::access (const int i, const int j) const
+{
+  static const float zero = 0;
+  int lo = starts[i], hi = starts[i + 1];
+  while (lo < hi)
+    {
+      int mid = (lo + hi) / 2;
+      if (columns[mid] < j)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+  return lo < starts[i + 1] && columns[lo] == j ? &values[lo] : &zero;
+}
+
+void SparseMatrix::expandRow (int i, float *dense) const
+{
+  for (int j = 0; j < cols; j++)
+    dense[j] = 0;
+  for (int e = starts[i]; e < starts[i + 1]; e++)
+    dense[columns[e]] = values[e];
+}
+
+float SparseMatrix::fold (const SparseMatrix &m, Matrix::FoldOp op)
+{
+  double acc = reductionIdentity<double>(op);
+  for (size_t e = 0; e < m.values.size(); e++)
+    acc = reductionCombine<double>(acc, m.values[e], op);
+  if ((long) m.values.size() < (long) m.rows * m.cols)
+    acc = reductionCombine<double>(acc, 0, op);
+  return acc;
+}
+
+Matrix SparseMatrix::foldRows (const SparseMatrix &m, Matrix::FoldOp op)
+{
+  Matrix r(m.rows, 1);
+  for (int i = 0; i < m.rows; i++)
+    {
+      double acc = reductionIdentity<double>(op);
+      for (int e = m.starts[i]; e < m.starts[i + 1]; e++)
+        acc = reductionCombine<double>(acc, m.values[e], op);
+      if (m.starts[i + 1] - m.starts[i] < m.cols)
+        acc = reductionCombine<double>(acc, 0, op);
+      *r.access(i, 0) = acc;
+    }
+  return r;
+}
+
+Matrix SparseMatrix::foldCols (const SparseMatrix &m, Matrix::FoldOp op)
+{
+  std::vector<double> acc(m.cols, reductionIdentity<double>(op));
+  std::vector<int> stored(m.cols, 0);
+  for (size_t e = 0; e < m.values.size(); e++)
+    {
+      acc[m.columns[e]] = reductionCombine<double>(acc[m.columns[e]], m.values[e], op);
+      stored[m.columns[e]]++;
+    }
+  Matrix r(1, m.cols);
+  for (int j = 0; j < m.cols; j++)
+    *r.access(0, j) = stored[j] < m.rows ? reductionCombine<double>(acc[j], 0, op) : acc[j];
+  return r;
+}
+
+std::ostream& operator<< (std::ostream &os, const SparseMatrix &m)
+{
+  std::vector<float> row(m.cols);
+  os << m.rows << " " << m.cols << std::endl;
+  for (int i = 0; i < m.rows; i++)
+    {
+      m.expandRow(i, row.data());
+      for (int j = 0; j < m.cols; j++)
+        os << row[j] << "  ";
+      os << std::endl;
+    }
+  return os;
+}
+
+/* The table is the sorted distinct values; a cell's code is its index
+   there.  Matrices with a NaN or a -0 cell, which the search would not
+   find or would confuse with 0, are held as floats. */
+QuantizedMatrix::QuantizedMatrix (const Matrix &m)
+  : rows(m.rows), cols(m.cols), width(32)
+{
+  size_t n = (size_t) rows * cols;
+  /* The distinct values, collected until there are more than a 16-bit
+     code can name or a NaN or -0, which the table cannot tell apart
+     from other values, turns up; either way the cells stay floats. */
+  std::unordered_set<float> distinct;
+  bool plain = true;
+  for (int i = 0; i < rows && plain && distinct.size() <= 65536; i++)
+    for (int j = 0; j < cols; j++)
+      {
+        float v = m.data[i][j];
+        if (v != v || (v == 0 && signbit(v)))
+          {
+            plain = false;
+            break;
+          }
+        distinct.insert(v);
+        if (distinct.size() > 65536)
+          break;
+      }
+  if (!plain || distinct.size() > 65536)
+    {
+      floats.reserve(n);
+      for (int i = 0; i < rows; i++)
+        floats.insert(floats.end(), m.data[i], m.data[i] + cols);
+      return;
+    }
+  table.assign(distinct.begin(), distinct.end());
+  std::sort(table.begin(), table.end());
+  width = table.size() <= 256 ? 8 : 16;
+  if (width == 8)
+    bytes.resize(n);
+  else
+    words.resize(n);
+  size_t k = 0;
+  for (int i = 0; i < rows; i++)
+    for (int j = 0; j < cols; j++, k++)
+      {
+        size_t code = std::lower_bound(table.begin(), table.end(), m.data[i][j]) - table.begin();
+        if (width == 8)
+          bytes[k] = (uint8_t) code;
+        else
+          words[k] = (uint16_t) code;
+      }
+}
@@ -2,13 +2,110 @@
 #define MATRIX_H
 
 #include <stdlib.h>
+#include <stdint.h>
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
+class SummedAreaTable ;
+class Mask ;
+class Cube ;
+class SparseMatrix ;
+template <class T> class TypedMatrix ;
+class QuantizedMatrix ;
+template <class E> class MatrixExpr ;
+
+/* Reduction kernels over n contiguous floats.  They keep eight partial
+   results so that the compiler vectorizes them at -O2. */
+double sumKernel ( const float *a, int n ) ;
+float maxKernel ( const float *a, int n, float init ) ;
+float minKernel ( const float *a, int n, float init ) ;
+
+/* Number of threads the runtime may use, from FCAL_THREADS (default 1). */
+int fcalThreads ( ) ;
+
+/* Runs body(lo, hi) over [0, n) cut into ranges, one per thread, when
+   parallel is set, there are several threads and the work, in cells,
+   is large enough to pay for them.  The ranges must be independent. */
+template <class F> void parallelRanges ( int n, long cells, bool parallel, F body ) {
+  int threads = parallel && cells >= (1L << 16) ? fcalThreads() : 1;
+  if (threads > n)
+    threads = n;
+  if (threads <= 1)
+    {
+      body(0, n);
+      return;
+    }
+  std::vector<std::thread> pool;
+  for (int t = 1; t < threads; t++)
+    pool.push_back(std::thread(body, (int) ((long) n * t / threads),
+                               (int) ((long) n * (t + 1) / threads)));
+  body(0, (int) ((long) n / threads));
+  for (size_t t = 0; t < pool.size(); t++)
+    pool[t].join();
+}
+
+/* Driver of a program with a tile parameter, main ( tile ) { ... },
+   whose body the translator emits as program and whose main returns
+   runTiles(argc, argv, program).  Usage:
+
+     prog [-j jobs] [--memory bytes] [--output dir] [--list file] tile ...
+
+   Each tile, named on the command line or one per line in the --list
+   file, is run in a child process of its own, with its print output in
+   tile.out or, with --output, in dir/ followed by the base name of the
+   tile and .out.  Tiles are taken from the queue in order, at most jobs
+   at a time (default: the processors over FCAL_THREADS), and only while
+   the estimated peak memory of the running tiles stays within the
+   budget (default: half the physical memory); one tile always runs.
+   A tile is estimated at its file size times the largest ratio of peak
+   memory to file size seen so far for tiles of 1 MB or more, 8 at first.
+   Failed tiles are reported on standard error; the exit status is 0 if
+   every tile ran, 1 if some failed and 2 for bad arguments. */
+int runTiles ( int argc, char **argv, void (*program) ( std::string tile ) ) ;
+
+/* Bounds checking policy of Matrix::at.  The default, UncheckedAccess,
+   compiles to nothing; building with -DFCAL_BOUNDS_CHECK selects
+   CheckedAccess, which stops the program on an out of range index. */
+struct UncheckedAccess {
+  static void check(int, int, int, int) { }
+  static void check(int, int, int, const int *) { }
+};
+
+struct CheckedAccess {
+  static void check(int i, int j, int rows, int cols) {
+    if (i < 0 || i >= rows || j < 0 || j >= cols)
+      boundsError(i, j, rows, cols, 0, "Matrix::at");
+  }
+  /* For a Cube, of extents[0] x extents[1] x extents[2] cells. */
+  static void check(int i, int j, int k, const int *extents) {
+    if (i < 0 || i >= extents[0] || j < 0 || j >= extents[1] || k < 0 || k >= extents[2])
+      boundsError(i, j, k, extents, 0, "Cube::at");
+  }
+  static void boundsError(int i, int j, int rows, int cols,
+                          int line, const char *text);
+  static void boundsError(int i, int j, int k, const int *extents,
+                          int line, const char *text);
+  /* For extent with an axis other than 0, 1 or 2. */
+  static void axisError(int axis, int line, const char *text);
+};
+
+#ifdef FCAL_BOUNDS_CHECK
+typedef CheckedAccess AccessPolicy;
+#else
+typedef UncheckedAccess AccessPolicy;
+#endif
 
 class Matrix {
  public:
   Matrix(int _rows, int _cols) ;
   Matrix (const Matrix& m) ;
+  Matrix& operator= (const Matrix& m) ;
+  ~Matrix () ;
 
   int numRows ( );
    
@@ -16,12 +113,97 @@ class Matrix {
    
 
   float *access(const int i, const int j) const ;
-  friend std::ostream& operator<<(std::ostream &os, Matrix &m) ;
 
+  /* Header-only element access.  Unlike access, which lives in
+     Matrix.cpp, the compiler can inline this into the loops of the
+     generated code and vectorize them. */
+  float &at(const int i, const int j) {
+    AccessPolicy::check(i, j, rows, cols);
+    return data[i][j];
+  }
+  const float &at(const int i, const int j) const {
+    AccessPolicy::check(i, j, rows, cols);
+    return data[i][j];
+  }
+
+  /* Always checked access, emitted by the translator's bounds checking
+     mode; line and text locate the indexing in the FCAL program. */
+  float &checkedAt(const int i, const int j, int line, const char *text) {
+    if (i < 0 || i >= rows || j < 0 || j >= cols)
+      CheckedAccess::boundsError(i, j, rows, cols, line, text);
+    return data[i][j];
+  }
+  friend std::ostream& operator<<(std::ostream &os, const Matrix &m) ;
+
+  /* Reads a matrix in the text format, "rows cols" and then the cells,
+     or in the binary format that writeMatrix writes. */
   static Matrix readMatrix ( std::string filename ) ;
 
+  /* Writes m to filename in the binary format of Printer, for the
+     next program to read back without parsing. */
+  static void writeMatrix ( const Matrix &m, std::string filename ) ;
+
+  /* Evaluate an element-wise expression such as a + b * c, see
+     ElementWise, in a single pass over its cells. */
+  template <class E> Matrix ( const MatrixExpr<E> &e ) ;
+  template <class E> Matrix& operator= ( const MatrixExpr<E> &e ) ;
+
+  /* Stops the program: the operands of the element-wise op differ in size. */
+  static void shapeError ( const char *op, int rows1, int cols1,
+                           int rows2, int cols2 ) ;
+
+  /* The product a * b, the matmul builtin.  Stops the program when the
+     columns of a do not match the rows of b. */
+  static Matrix multiply ( const Matrix &a, const Matrix &b ) ;
+
+  /* c[i, j] += a[i, k] * b[k, j] for i0 <= i <= i1, j0 <= j <= j1 and
+     k0 <= k <= k1, the classic triple loop.  Blocked so that a block of
+     b stays in cache, vectorized over j, and with the rows of c shared
+     out over FCAL_THREADS threads (default 1).  Every c[i, j] still
+     adds its products in increasing k, so the result is that of the
+     loop.  c must be neither a nor b. */
+  static void multiplyAdd ( Matrix &c, const Matrix &a, const Matrix &b,
+                            int i0, int i1, int j0, int j1, int k0, int k1 ) ;
+
+  /* The collection operators.  map and zip apply f to every cell, or
+     pair of cells at the same position, and filter keeps the cells for
+     which keep holds, in row-major order, as a column.  With parallel
+     set, rows are shared out over fcalThreads() threads, so f must not
+     have side effects.  fold combines all cells, or those of each row
+     or column, with op; it reduces rows in parallel and combines their
+     results in a fixed tree, so sums are reassociated but the same for
+     any number of threads.  Folding nothing gives the identity of op. */
+  template <class F> static Matrix map ( const Matrix &m, F f, bool parallel ) ;
+  template <class F> static Matrix zip ( const Matrix &a, const Matrix &b,
+                                         F f, bool parallel ) ;
+  template <class F> static Matrix filter ( const Matrix &m, F keep, bool parallel ) ;
+  enum FoldOp { FoldSum, FoldProduct, FoldMax, FoldMin } ;
+  static float fold ( const Matrix &m, FoldOp op ) ;
+  static Matrix foldRows ( const Matrix &m, FoldOp op ) ;
+  static Matrix foldCols ( const Matrix &m, FoldOp op ) ;
+
+  /* Summed-area table of this matrix, built on the first call.  Only
+     valid while the matrix is not written to; the translator uses it
+     for matrices that are read-only after their declaration. */
+  const SummedAreaTable &prefixSums ( ) ;
+
+  /* Reductions over row i, columns c0 to c1, emitted by the translator
+     for loops recognized as reductions.  They run the vectorized
+     kernels below, so they reassociate: the sum is accumulated in
+     double, in several lanes.  An empty range gives 0, or init. */
+  double rowSum ( int i, int c0, int c1 ) const ;
+  float rowMax ( int i, int c0, int c1, float init ) const ;
+  float rowMin ( int i, int c0, int c1, float init ) const ;
+
  private:
-  Matrix() { }
+  Matrix() : rows(0), cols(0), data(NULL), sums(NULL) { }
+  void allocate ( int _rows, int _cols ) ;
+  void release ( ) ;
+  template <class E> void evaluate ( const E &e ) ;
+  friend class MatrixOperand ;
+  friend class Printer ;
+  friend class Mask ;
+  friend class QuantizedMatrix ;
   int rows ;
   int cols ;
 
@@ -32,6 +214,1115 @@ class Matrix {
        you. */
   /* this points to a 2D array of floats. */
   float **data;
+
+  SummedAreaTable *sums; // built by prefixSums
+} ;
+
+/* Element-wise expressions over matrices.  With a, b and c matrices,
+   a + b * c builds an ElementWise tree holding references to a, b and
+   c; nothing is computed until the tree is assigned to a Matrix or
+   printed.  It is then evaluated one row at a time, each cell in one
+   pass over the operands, so no intermediate matrix is made.  Scalars
+   are broadcast to every cell, and comparisons give 1 where they hold
+   and 0 elsewhere.  Operands of different sizes stop the program. */
+template <class E> class MatrixExpr {
+ public:
+  const E &self ( ) const { return static_cast<const E &>(*this); }
+} ;
+
+/* A matrix operand; its rows are read straight from the matrix. */
+class MatrixOperand : public MatrixExpr<MatrixOperand> {
+ public:
+  explicit MatrixOperand ( const Matrix &_m ) : m(_m) { }
+  int numRows ( ) const { return m.rows; }
+  int numCols ( ) const { return m.cols; }
+
+  struct Row {
+    const float *cells;
+    float operator[] ( int j ) const { return cells[j]; }
+  } ;
+  Row row ( int i ) const { Row r = { m.data[i] }; return r; }
+
+ private:
+  const Matrix &m ;
+} ;
+
+/* A scalar operand, the same in every cell.  It has no size, -1. */
+class ScalarOperand {
+ public:
+  explicit ScalarOperand ( float _v ) : v(_v) { }
+  int numRows ( ) const { return -1; }
+  int numCols ( ) const { return -1; }
+
+  struct Row {
+    float v;
+    float operator[] ( int ) const { return v; }
+  } ;
+  Row row ( int ) const { Row r = { v }; return r; }
+
+ private:
+  float v ;
+} ;
+
+/* The operations, as used by ElementWise. */
+#define FCAL_ELEMENTWISE_OP(Op, op, result)                          \
+  struct Op {                                                         \
+    static const char *name ( ) { return #op; }                       \
+    static float apply ( float a, float b ) { return result; }        \
+  } ;
+FCAL_ELEMENTWISE_OP(PlusOp, +, a + b)
+FCAL_ELEMENTWISE_OP(MinusOp, -, a - b)
+FCAL_ELEMENTWISE_OP(TimesOp, *, a * b)
+FCAL_ELEMENTWISE_OP(DivideOp, /, a / b)
+FCAL_ELEMENTWISE_OP(LessOp, <, a < b ? 1.0f : 0.0f)
+FCAL_ELEMENTWISE_OP(LessEqualOp, <=, a <= b ? 1.0f : 0.0f)
+FCAL_ELEMENTWISE_OP(GreaterOp, >, a > b ? 1.0f : 0.0f)
+FCAL_ELEMENTWISE_OP(GreaterEqualOp, >=, a >= b ? 1.0f : 0.0f)
+FCAL_ELEMENTWISE_OP(EqualOp, ==, a == b ? 1.0f : 0.0f)
+FCAL_ELEMENTWISE_OP(NotEqualOp, !=, a != b ? 1.0f : 0.0f)
+#undef FCAL_ELEMENTWISE_OP
+
+/* l op r, cell by cell.  L and R are MatrixOperand, ScalarOperand or
+   ElementWise, held by value; only the matrices are references. */
+template <class Op, class L, class R>
+class ElementWise : public MatrixExpr<ElementWise<Op, L, R> > {
+ public:
+  ElementWise ( const L &_l, const R &_r ) : l(_l), r(_r) {
+    if (l.numRows() >= 0 && r.numRows() >= 0
+        && (l.numRows() != r.numRows() || l.numCols() != r.numCols()))
+      Matrix::shapeError(Op::name(), l.numRows(), l.numCols(),
+                         r.numRows(), r.numCols());
+  }
+  int numRows ( ) const { return l.numRows() >= 0 ? l.numRows() : r.numRows(); }
+  int numCols ( ) const { return l.numCols() >= 0 ? l.numCols() : r.numCols(); }
+
+  struct Row {
+    typename L::Row l;
+    typename R::Row r;
+    float operator[] ( int j ) const { return Op::apply(l[j], r[j]); }
+  } ;
+  Row row ( int i ) const { Row x = { l.row(i), r.row(i) }; return x; }
+
+ private:
+  L l ;
+  R r ;
+} ;
+
+/* How a C++ value of type T takes part in an element-wise expression.
+   Types that cannot, such as strings, have no member type, so that
+   the operators below do not apply to them. */
+template <class T, class Enable = void> struct Operand {
+  static const bool matrix = false;
+} ;
+template <> struct Operand<Matrix> {
+  typedef MatrixOperand type;
+  static const bool matrix = true;
+  static type wrap ( const Matrix &m ) { return type(m); }
+} ;
+template <class E>
+struct Operand<E, typename std::enable_if<std::is_base_of<MatrixExpr<E>, E>::value>::type> {
+  typedef E type;
+  static const bool matrix = true;
+  static const E &wrap ( const E &e ) { return e; }
+} ;
+template <class T>
+struct Operand<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+  typedef ScalarOperand type;
+  static const bool matrix = false;
+  static type wrap ( T v ) { return type(v); }
+} ;
+
+/* The operators, for any two operands of which at least one is a matrix. */
+#define FCAL_ELEMENTWISE(op, Op)                                              \
+  template <class L, class R>                                                 \
+  typename std::enable_if<Operand<L>::matrix || Operand<R>::matrix,           \
+    ElementWise<Op, typename Operand<L>::type, typename Operand<R>::type> >::type \
+  operator op ( const L &l, const R &r ) {                                    \
+    return ElementWise<Op, typename Operand<L>::type, typename Operand<R>::type> \
+      (Operand<L>::wrap(l), Operand<R>::wrap(r));                             \
+  }
+FCAL_ELEMENTWISE(+, PlusOp)
+FCAL_ELEMENTWISE(-, MinusOp)
+FCAL_ELEMENTWISE(*, TimesOp)
+FCAL_ELEMENTWISE(/, DivideOp)
+FCAL_ELEMENTWISE(<, LessOp)
+FCAL_ELEMENTWISE(<=, LessEqualOp)
+FCAL_ELEMENTWISE(>, GreaterOp)
+FCAL_ELEMENTWISE(>=, GreaterEqualOp)
+FCAL_ELEMENTWISE(==, EqualOp)
+FCAL_ELEMENTWISE(!=, NotEqualOp)
+#undef FCAL_ELEMENTWISE
+
+template <class E> std::ostream& operator<< ( std::ostream &os, const MatrixExpr<E> &e ) {
+  return os << Matrix(e);
+}
+
+template <class E> Matrix::Matrix ( const MatrixExpr<E> &e ) {
+  allocate(e.self().numRows(), e.self().numCols());
+  evaluate(e.self());
+}
+
+/* A matrix of the same size is overwritten in place, which is safe as
+   cell (i, j) only reads cell (i, j) of the operands. */
+template <class E> Matrix& Matrix::operator= ( const MatrixExpr<E> &e ) {
+  const E &x = e.self();
+  if (x.numRows() != rows || x.numCols() != cols)
+    {
+      release();
+      allocate(x.numRows(), x.numCols());
+    }
+  delete sums;
+  sums = NULL;
+  evaluate(x);
+  return *this;
+}
+
+/* Eight cells are read before any is written, so that the compiler
+   vectorizes the loop at -O2 even when the result is an operand. */
+template <class E> void Matrix::evaluate ( const E &e ) {
+  for (int i = 0; i < rows; i++)
+    {
+      typename E::Row r = e.row(i);
+      float *out = data[i];
+      int j = 0;
+      for (; j + 8 <= cols; j += 8)
+        {
+          float lanes[8];
+          for (int l = 0; l < 8; l++)
+            lanes[l] = r[j + l];
+          for (int l = 0; l < 8; l++)
+            out[j + l] = lanes[l];
+        }
+      for (; j < cols; j++)
+        out[j] = r[j];
+    }
+}
+
+/* Eight cells are computed before any is stored, as in evaluate, so
+   that the loops vectorize when f allows it. */
+template <class F> Matrix Matrix::map ( const Matrix &m, F f, bool parallel ) {
+  Matrix r(m.rows, m.cols);
+  parallelRanges(m.rows, (long) m.rows * m.cols, parallel, [&] (int i0, int i1) {
+      for (int i = i0; i < i1; i++)
+        {
+          const float *in = m.data[i];
+          float *out = r.data[i];
+          int j = 0;
+          for (; j + 8 <= m.cols; j += 8)
+            {
+              float lanes[8];
+              for (int l = 0; l < 8; l++)
+                lanes[l] = f(in[j + l]);
+              for (int l = 0; l < 8; l++)
+                out[j + l] = lanes[l];
+            }
+          for (; j < m.cols; j++)
+            out[j] = f(in[j]);
+        }
+    });
+  return r;
+}
+
+template <class F> Matrix Matrix::zip ( const Matrix &a, const Matrix &b,
+                                        F f, bool parallel ) {
+  if (a.rows != b.rows || a.cols != b.cols)
+    shapeError("zip", a.rows, a.cols, b.rows, b.cols);
+  Matrix r(a.rows, a.cols);
+  parallelRanges(a.rows, (long) a.rows * a.cols, parallel, [&] (int i0, int i1) {
+      for (int i = i0; i < i1; i++)
+        {
+          const float *x = a.data[i], *y = b.data[i];
+          float *out = r.data[i];
+          int j = 0;
+          for (; j + 8 <= a.cols; j += 8)
+            {
+              float lanes[8];
+              for (int l = 0; l < 8; l++)
+                lanes[l] = f(x[j + l], y[j + l]);
+              for (int l = 0; l < 8; l++)
+                out[j + l] = lanes[l];
+            }
+          for (; j < a.cols; j++)
+            out[j] = f(x[j], y[j]);
+        }
+    });
+  return r;
+}
+
+/* Each row collects its cells apart, and the rows are then joined in
+   order, so the result does not depend on the threads. */
+template <class F> Matrix Matrix::filter ( const Matrix &m, F keep, bool parallel ) {
+  std::vector<std::vector<float> > kept(m.rows);
+  parallelRanges(m.rows, (long) m.rows * m.cols, parallel, [&] (int i0, int i1) {
+      for (int i = i0; i < i1; i++)
+        for (int j = 0; j < m.cols; j++)
+          if (keep(m.data[i][j]))
+            kept[i].push_back(m.data[i][j]);
+    });
+  size_t n = 0;
+  for (int i = 0; i < m.rows; i++)
+    n += kept[i].size();
+  Matrix r((int) n, 1);
+  n = 0;
+  for (int i = 0; i < m.rows; i++)
+    for (size_t k = 0; k < kept[i].size(); k++)
+      r.data[n++][0] = kept[i][k];
+  return r;
+}
+
+/* The value of folding, or reducing, nothing with op. */
+template <class T> T reductionIdentity ( Matrix::FoldOp op ) {
+  typedef std::numeric_limits<T> limits;
+  switch (op)
+    {
+    case Matrix::FoldSum: return 0;
+    case Matrix::FoldProduct: return 1;
+    case Matrix::FoldMax: return limits::has_infinity ? -limits::infinity() : limits::lowest();
+    default: return limits::has_infinity ? limits::infinity() : limits::max();
+    }
+}
+
+template <class T> T reductionCombine ( T a, T b, Matrix::FoldOp op ) {
+  switch (op)
+    {
+    case Matrix::FoldSum: return a + b;
+    case Matrix::FoldProduct: return a * b;
+    case Matrix::FoldMax: return a < b ? b : a;
+    default: return b < a ? b : a;
+    }
+}
+
+/* Combines partials pairwise, in a tree whose shape only depends on
+   their number, and then init with the result.  partials is
+   overwritten. */
+template <class T> T combinePartials ( std::vector<T> &partials, T init,
+                                       Matrix::FoldOp op ) {
+  size_t n = partials.size();
+  if (n == 0)
+    return init;
+  for (size_t width = 1; width < n; width *= 2)
+    for (size_t i = 0; i + width < n; i += 2 * width)
+      partials[i] = reductionCombine(partials[i], partials[i + width], op);
+  return reductionCombine(init, partials[0], op);
+}
+
+/* A parfor loop over first..last is cut into a fixed number of parts,
+   each run sequentially, so that its reductions combine the same
+   partial results, in the same order, for any number of threads. */
+inline int parforPartCount ( int first, int last ) {
+  long n = (long) last - first + 1;
+  return n < 1 ? 1 : n < 64 ? (int) n : 64;
+}
+
+/* Runs body(part, lo, hi) for the parts of first..last, sharing them out
+   over fcalThreads() threads whatever the size of the loop, which the
+   program asked to run in parallel. */
+template <class F> void parforRun ( int first, int last, int parts, F body ) {
+  long n = (long) last - first + 1;
+  if (n < 0)
+    n = 0;
+  parallelRanges(parts, std::numeric_limits<long>::max(), true, [&] (int p0, int p1) {
+      for (int p = p0; p < p1; p++)
+        body(p, first + (int) (n * p / parts), first + (int) (n * (p + 1) / parts) - 1);
+    });
+}
+
+/* Fills m with kernel(i, j), for a comprehension whose cells only read
+   their own row of other matrices and have no other effects.  Blocks of
+   rows are handed out from a shared counter to fcalThreads() threads,
+   several blocks per thread so that uneven rows balance out; a thread
+   computes whole rows, so each block reads its input rows once.  As in
+   parallelRanges, a matrix of fewer than 1 << 16 cells is filled by the
+   calling thread alone. */
+template <class K> void rowKernelRun ( Matrix &m, K kernel ) {
+  int rows = m.numRows(), cols = m.numCols();
+  int threads = (long) rows * cols >= (1L << 16) ? fcalThreads() : 1;
+  if (threads > rows)
+    threads = rows;
+  int block = threads > 1 ? rows / (threads * 8) : rows;
+  if (block < 1)
+    block = 1;
+  std::atomic<int> next(0);
+  auto work = [&] () {
+    for (int i0; (i0 = next.fetch_add(block)) < rows; )
+      for (int i = i0; i < i0 + block && i < rows; i++)
+        for (int j = 0; j < cols; j++)
+          *m.access(i, j) = kernel(i, j);
+  };
+  std::vector<std::thread> pool;
+  for (int t = 1; t < threads; t++)
+    pool.push_back(std::thread(work));
+  work();
+  for (size_t t = 0; t < pool.size(); t++)
+    pool[t].join();
+}
+
+/* A matrix of bits, such as the cloud or no-data flags of pixels,
+   packed 64 to a word.  Every row starts a new word and the bits past
+   its last column are kept clear, so that whole masks are combined
+   with &&, || and ! and counted a word at a time.  A cell reads and
+   writes through a Bit, which takes the place of the float & of a
+   Matrix cell, so the translator indexes masks as it does matrices. */
+class Mask {
+ public:
+  class Bit {
+   public:
+    Bit ( uint64_t *_word, uint64_t _bit ) : word(_word), bit(_bit) { }
+    operator bool ( ) const { return (*word & bit) != 0; }
+    Bit &operator= ( bool v ) {
+      if (v) *word |= bit; else *word &= ~bit;
+      return *this;
+    }
+    Bit &operator= ( const Bit &b ) { return *this = (bool) b; }
+   private:
+    uint64_t *word ;
+    uint64_t bit ;
+  } ;
+
+  /* What access returns: *access(i, j) is the Bit of cell (i, j). */
+  class BitPointer {
+   public:
+    BitPointer ( uint64_t *_word, uint64_t _bit ) : word(_word), bit(_bit) { }
+    Bit operator* ( ) const { return Bit(word, bit); }
+   private:
+    uint64_t *word ;
+    uint64_t bit ;
+  } ;
+
+  /* All cells clear. */
+  Mask ( int _rows, int _cols ) ;
+  /* Set where the cells of a matrix, or of an element-wise expression
+     such as data > 0.5, are not 0. */
+  Mask ( const Matrix &m ) ;
+  template <class E> Mask ( const MatrixExpr<E> &e ) ;
+
+  /* The mask of rows x cols cells whose cell (i, j) is cell(i, j),
+     filled in a word at a time; the Mask comprehension. */
+  template <class F> static Mask build ( int rows, int cols, F cell ) ;
+
+  int numRows ( ) const { return rows; }
+  int numCols ( ) const { return cols; }
+
+  BitPointer access ( const int i, const int j ) const {
+    return BitPointer(&words[(size_t) i * stride + (j >> 6)], (uint64_t) 1 << (j & 63));
+  }
+  Bit at ( const int i, const int j ) {
+    AccessPolicy::check(i, j, rows, cols);
+    return *access(i, j);
+  }
+  Bit checkedAt ( const int i, const int j, int line, const char *text ) {
+    if (i < 0 || i >= rows || j < 0 || j >= cols)
+      CheckedAccess::boundsError(i, j, rows, cols, line, text);
+    return *access(i, j);
+  }
+
+  /* Number of set cells, the count builtin. */
+  long count ( ) const ;
+
+  /* Cell-wise and, or and not.  Masks of different sizes stop the
+     program, as for the element-wise matrix operators. */
+  friend Mask operator&& ( const Mask &a, const Mask &b ) ;
+  friend Mask operator|| ( const Mask &a, const Mask &b ) ;
+  friend Mask operator! ( const Mask &a ) ;
+
+  friend std::ostream& operator<< ( std::ostream &os, const Mask &m ) ;
+
+ private:
+  template <class E> void fill ( const E &e ) ;
+  friend class Printer ;
+
+  int rows ;
+  int cols ;
+  int stride ;                           // words per row
+  mutable std::vector<uint64_t> words ;  // row i is words[i * stride ...]
+} ;
+
+template <class F> Mask Mask::build ( int rows, int cols, F cell ) {
+  Mask m(rows, cols);
+  for (int i = 0; i < rows; i++)
+    for (int w = 0; w < m.stride; w++)
+      {
+        int j0 = w * 64, n = cols - j0 < 64 ? cols - j0 : 64;
+        uint64_t bits = 0;
+        for (int b = 0; b < n; b++)
+          bits |= (uint64_t) (cell(i, j0 + b) ? 1 : 0) << b;
+        m.words[(size_t) i * m.stride + w] = bits;
+      }
+  return m;
+}
+
+template <class E> Mask::Mask ( const MatrixExpr<E> &e )
+  : rows(e.self().numRows()), cols(e.self().numCols()), stride((cols + 63) / 64),
+    words((size_t) rows * stride, 0) {
+  fill(e.self());
+}
+
+template <class E> void Mask::fill ( const E &e ) {
+  for (int i = 0; i < rows; i++)
+    {
+      typename E::Row r = e.row(i);
+      for (int w = 0; w < stride; w++)
+        {
+          int j0 = w * 64, n = cols - j0 < 64 ? cols - j0 : 64;
+          uint64_t bits = 0;
+          for (int b = 0; b < n; b++)
+            bits |= (uint64_t) (r[j0 + b] != 0.0f) << b;
+          words[(size_t) i * stride + w] = bits;
+        }
+    }
+}
+
+/* A three-dimensional array of floats, such as the pixel x year x
+   season cube of a time series, in one contiguous block.  The layout
+   says which index moves fastest through memory: with LastFastest,
+   the default, cells (i, j, k) and (i, j, k + 1) are neighbours, so
+   the whole series of a pixel is contiguous; with FirstFastest cells
+   (i, j, k) and (i + 1, j, k) are, so each (year, season) band is.
+   Loops should run their innermost index along the fast one. */
+class Cube {
+ public:
+  enum Layout { LastFastest, FirstFastest } ;
+
+  /* All cells 0. */
+  Cube ( int d0, int d1, int d2, Layout _layout = LastFastest ) ;
+  Cube ( const Cube &c ) ;
+  Cube &operator= ( const Cube &c ) ;
+  ~Cube () ;
+
+  /* The cube whose cell (i, j, k) is cell(i, j, k), computed in the
+     order of the layout; the Cube comprehension. */
+  template <class F> static Cube build ( int d0, int d1, int d2, F cell,
+                                         Layout layout = LastFastest ) ;
+  /* The cube whose cell (i, j, k) is cell (i, j * d2 + k) of m, which
+     must be d0 x (d1 * d2); the Cube declaration Cube c [d0, d1, d2] = m
+     when it cannot be a CubeView. */
+  template <class M> static Cube rowsOf ( M &&m, int d0, int d1, int d2,
+                                          Layout layout = LastFastest ) ;
+  static void shapeError ( int rows, int cols, int d0, int d1, int d2 ) ;
+
+  /* Number of cells along axis 0, 1 or 2, the extent builtin. */
+  int extent ( int axis ) const { return extents[axis]; }
+  int checkedExtent ( int axis, int line, const char *text ) const {
+    if (axis < 0 || axis > 2)
+      CheckedAccess::axisError(axis, line, text);
+    return extents[axis];
+  }
+  Layout layout ( ) const { return order; }
+
+  float *access ( const int i, const int j, const int k ) const {
+    return cells + i * strides[0] + j * strides[1] + k * strides[2];
+  }
+  float &at ( const int i, const int j, const int k ) {
+    AccessPolicy::check(i, j, k, extents);
+    return *access(i, j, k);
+  }
+  float &checkedAt ( const int i, const int j, const int k, int line, const char *text ) {
+    if (i < 0 || i >= extents[0] || j < 0 || j >= extents[1] || k < 0 || k >= extents[2])
+      CheckedAccess::boundsError(i, j, k, extents, line, text);
+    return *access(i, j, k);
+  }
+
+  friend std::ostream& operator<< ( std::ostream &os, const Cube &c ) ;
+
+ private:
+  friend class Printer ;
+  void allocate ( ) ;
+
+  int extents[3] ;
+  long strides[3] ;  // cell (i, j, k) is cells[i * strides[0] + ...]
+  Layout order ;
+  float *cells ;
+} ;
+
+template <class F> Cube Cube::build ( int d0, int d1, int d2, F cell, Layout layout ) {
+  Cube c(d0, d1, d2, layout);
+  if (layout == LastFastest)
+    {
+      float *out = c.cells;
+      for (int i = 0; i < d0; i++)
+        for (int j = 0; j < d1; j++)
+          for (int k = 0; k < d2; k++)
+            *out++ = cell(i, j, k);
+    }
+  else
+    {
+      float *out = c.cells;
+      for (int k = 0; k < d2; k++)
+        for (int j = 0; j < d1; j++)
+          for (int i = 0; i < d0; i++)
+            *out++ = cell(i, j, k);
+    }
+  return c;
+}
+
+template <class M> Cube Cube::rowsOf ( M &&m, int d0, int d1, int d2, Layout layout ) {
+  if (m.numRows() != d0 || m.numCols() != (long) d1 * d2)
+    shapeError(m.numRows(), m.numCols(), d0, d1, d2);
+  return build(d0, d1, d2, [&] (int i, int j, int k) -> float {
+      return *m.access(i, j * d2 + k); }, layout);
+}
+
+/* The rows of a matrix read as a d0 x d1 x d2 cube without copying them:
+   cell (i, j, k) is cell (i, j * d2 + k) of the matrix, as in a Cube of
+   layout LastFastest.  The matrix must outlive the view, and neither
+   may be changed through it. */
+template <class M> class CubeView {
+ public:
+  CubeView ( M &_base, int d0, int d1, int d2 ) : base(_base) {
+    if (base.numRows() != d0 || base.numCols() != (long) d1 * d2)
+      Cube::shapeError(base.numRows(), base.numCols(), d0, d1, d2);
+    extents[0] = d0;
+    extents[1] = d1;
+    extents[2] = d2;
+  }
+
+  int extent ( int axis ) const { return extents[axis]; }
+  int checkedExtent ( int axis, int line, const char *text ) const {
+    if (axis < 0 || axis > 2)
+      CheckedAccess::axisError(axis, line, text);
+    return extents[axis];
+  }
+
+  float *access ( const int i, const int j, const int k ) const {
+    return base.access(i, j * extents[2] + k);
+  }
+  float &at ( const int i, const int j, const int k ) {
+    AccessPolicy::check(i, j, k, extents);
+    return *access(i, j, k);
+  }
+  float &checkedAt ( const int i, const int j, const int k, int line, const char *text ) {
+    if (i < 0 || i >= extents[0] || j < 0 || j >= extents[1] || k < 0 || k >= extents[2])
+      CheckedAccess::boundsError(i, j, k, extents, line, text);
+    return *access(i, j, k);
+  }
+
+ private:
+  friend class Printer ;
+  M &base ;
+  int extents[3] ;
+  CubeView ( const CubeView & ) ;
+} ;
+
+/* A matrix of mostly zero cells in compressed sparse row (CSR) form:
+   the column and value of each stored cell, row by row, and where each
+   row starts among them.  Memory, iteration and the folds take time in
+   the number of stored cells, not rows * cols; a cell is found by a
+   binary search of its row.  Stored cells are never 0, and the matrix
+   cannot be changed once built. */
+class SparseMatrix {
+ public:
+  /* All cells 0. */
+  SparseMatrix ( int _rows, int _cols ) ;
+
+  /* The matrix whose cell (i, j) is cell(i, j), evaluated, and stored if
+     not 0, only where guard(i, j) holds; the Sparse comprehension
+     [rows, cols] i, j = if guard then cell else 0. */
+  template <class G, class F> static SparseMatrix build ( int rows, int cols, G guard, F cell ) ;
+  /* Likewise with every cell evaluated. */
+  template <class F> static SparseMatrix build ( int rows, int cols, F cell ) ;
+
+  int numRows ( ) const { return rows; }
+  int numCols ( ) const { return cols; }
+  /* Number of stored cells, the nnz builtin. */
+  int nnz ( ) const { return (int) values.size(); }
+
+  /* The stored cells of row i are e = rowBegin(i) .. rowEnd(i) - 1, in
+     increasing column(e), holding value(e). */
+  int rowBegin ( int i ) const { return starts[i]; }
+  int rowEnd ( int i ) const { return starts[i + 1]; }
+  int column ( int e ) const { return columns[e]; }
+  float value ( int e ) const { return values[e]; }
+
+  const float *access ( const int i, const int j ) const ;
+  float at ( const int i, const int j ) const {
+    AccessPolicy::check(i, j, rows, cols);
+    return *access(i, j);
+  }
+  float checkedAt ( const int i, const int j, int line, const char *text ) const {
+    if (i < 0 || i >= rows || j < 0 || j >= cols)
+      CheckedAccess::boundsError(i, j, rows, cols, line, text);
+    return *access(i, j);
+  }
+
+  /* The folds of Matrix, over the stored cells and, once, the 0 of the
+     cells that are not stored. */
+  static float fold ( const SparseMatrix &m, Matrix::FoldOp op ) ;
+  static Matrix foldRows ( const SparseMatrix &m, Matrix::FoldOp op ) ;
+  static Matrix foldCols ( const SparseMatrix &m, Matrix::FoldOp op ) ;
+
+  friend std::ostream& operator<< ( std::ostream &os, const SparseMatrix &m ) ;
+
+ private:
+  friend class Printer ;
+  /* Cells of row i, 0 where not stored, into dense[0 .. cols - 1]. */
+  void expandRow ( int i, float *dense ) const ;
+
+  int rows ;
+  int cols ;
+  std::vector<int> starts ;    // rows + 1 offsets into columns and values
+  std::vector<int> columns ;
+  std::vector<float> values ;
+} ;
+
+template <class G, class F> SparseMatrix SparseMatrix::build ( int rows, int cols, G guard, F cell ) {
+  SparseMatrix m(rows, cols);
+  for (int i = 0; i < rows; i++)
+    {
+      for (int j = 0; j < cols; j++)
+        if (guard(i, j))
+          {
+            float v = cell(i, j);
+            if (v != 0)
+              {
+                m.columns.push_back(j);
+                m.values.push_back(v);
+              }
+          }
+      m.starts[i + 1] = (int) m.values.size();
+    }
+  return m;
+}
+
+template <class F> SparseMatrix SparseMatrix::build ( int rows, int cols, F cell ) {
+  return build(rows, cols, [] (int, int) { return true; }, cell);
+}
+
+/* A matrix of cells of type T, such as double, int32_t or uint8_t, in
+   one row-major block; the Matrix<Double>, Matrix<Int> and Matrix<Byte>
+   comprehensions.  It only offers indexing and printing: the
+   element-wise operators, folds and kernels work on the float Matrix. */
+template <class T> class TypedMatrix {
+ public:
+  /* All cells 0. */
+  TypedMatrix ( int _rows, int _cols )
+    : rows(_rows), cols(_cols), cells((size_t) _rows * _cols, T()) { }
+
+  int numRows ( ) const { return rows; }
+  int numCols ( ) const { return cols; }
+
+  T *access ( const int i, const int j ) const {
+    return &cells[(size_t) i * cols + j];
+  }
+  T &at ( const int i, const int j ) {
+    AccessPolicy::check(i, j, rows, cols);
+    return *access(i, j);
+  }
+  T &checkedAt ( const int i, const int j, int line, const char *text ) {
+    if (i < 0 || i >= rows || j < 0 || j >= cols)
+      CheckedAccess::boundsError(i, j, rows, cols, line, text);
+    return *access(i, j);
+  }
+
+ private:
+  friend class Printer ;
+
+  int rows ;
+  int cols ;
+  mutable std::vector<T> cells ;
+} ;
+
+/* A read-only copy of a matrix, such as a band of a satellite image,
+   holding each cell as an 8- or 16-bit code into a table of the
+   distinct cell values: for a band stored as offset + scale * q with
+   q an integer, table[code] is that value.  Matrices with more than
+   65536 distinct values are held as floats.  The copy is exact, and
+   takes 4 or 2 times less memory and bandwidth than a Matrix; reading
+   a cell looks up its code in the table, which stays in cache. */
+class QuantizedMatrix {
+ public:
+  explicit QuantizedMatrix ( const Matrix &m ) ;
+
+  int numRows ( ) const { return rows; }
+  int numCols ( ) const { return cols; }
+  /* Bits per cell: 8, 16, or 32 for floats. */
+  int bits ( ) const { return width; }
+
+  /* *access(i, j) is the value of cell (i, j). */
+  struct Cell {
+    float value ;
+    float operator* ( ) const { return value; }
+  } ;
+  Cell access ( const int i, const int j ) const {
+    Cell c = { cell((size_t) i * cols + j) };
+    return c;
+  }
+  float at ( const int i, const int j ) const {
+    AccessPolicy::check(i, j, rows, cols);
+    return cell((size_t) i * cols + j);
+  }
+  float checkedAt ( const int i, const int j, int line, const char *text ) const {
+    if (i < 0 || i >= rows || j < 0 || j >= cols)
+      CheckedAccess::boundsError(i, j, rows, cols, line, text);
+    return cell((size_t) i * cols + j);
+  }
+
+ private:
+  float cell ( size_t k ) const {
+    if (width == 8)
+      return table[bytes[k]];
+    if (width == 16)
+      return table[words[k]];
+    return floats[k];
+  }
+
+  int rows ;
+  int cols ;
+  int width ;
+  std::vector<float> table ;      // distinct values, in increasing order
+  std::vector<uint8_t> bytes ;    // codes, row-major, when width is 8
+  std::vector<uint16_t> words ;   // when width is 16
+  std::vector<float> floats ;     // cells, when width is 32
+} ;
+
+/* As a Matrix, with each cell promoted (+c) so that bytes print as numbers. */
+template <class T> std::ostream& operator<< ( std::ostream &os, const TypedMatrix<T> &m ) {
+  os << m.numRows() << " " << m.numCols() << std::endl;
+  for (int i = 0; i < m.numRows(); i++)
+    {
+      for (int j = 0; j < m.numCols(); j++)
+        os << +*m.access(i, j) << "  ";
+      os << std::endl;
+    }
+  return os;
+}
+
+/* Buffered, locale-free output for the print statement, which the
+   translator emits as fcalOut << e.  Output collects in a 1 MB buffer
+   and is written to standard output in large writes, when the buffer
+   fills and when the program exits.  FCAL_PRINT selects the format:
+
+     text      (default) exactly what printing to std::cout gives:
+               numbers as %g, matrices as operator<< prints them
+     shortest  numbers in the shortest form that reads back to the
+               same float or double
+     binary    as shortest, but matrices are written in the binary
+               format: "FCM1", rows and cols as 32-bit ints, then the
+               cells row by row as 32-bit floats, in native byte order */
+class Printer {
+ public:
+  enum Format { Text, Shortest, Binary } ;
+
+  Printer ( int _fd, Format _format ) ;
+  ~Printer () ;
+
+  /* The format named by FCAL_PRINT, Text if it is unset or unknown. */
+  static Format formatFromEnvironment ( ) ;
+
+  Printer& operator<< ( int v ) ;
+  Printer& operator<< ( long v ) ;
+  Printer& operator<< ( float v ) ;
+  Printer& operator<< ( double v ) ;
+  Printer& operator<< ( const char *s ) ;
+  Printer& operator<< ( const std::string &s ) ;
+  Printer& operator<< ( const Matrix &m ) ;
+  /* As a matrix of 0 and 1. */
+  Printer& operator<< ( const Mask &m ) ;
+  /* "d0 d1 d2", then each i as a d1 x d2 block followed by a blank line. */
+  Printer& operator<< ( const Cube &c ) ;
+  template <class M> Printer& operator<< ( const CubeView<M> &c ) ;
+  /* As the Matrix of the same cells. */
+  Printer& operator<< ( const SparseMatrix &m ) ;
+  template <class E> Printer& operator<< ( const MatrixExpr<E> &e ) {
+    return *this << Matrix(e);
+  }
+  /* As the Matrix of the same cells; binary output converts them to float. */
+  template <class T> Printer& operator<< ( const TypedMatrix<T> &m ) ;
+
+  /* Writes out the buffer; false if writing failed. */
+  bool flush ( ) ;
+
+ private:
+  Printer ( const Printer & ) ;
+  Printer &operator= ( const Printer & ) ;
+  /* Room for n more bytes in the buffer, flushing it if need be. */
+  char *reserve ( size_t n ) ;
+  void put ( const char *s, size_t n ) ;
+
+  int fd ;
+  Format format ;
+  char *buffer ;
+  size_t used ;
+  size_t capacity ;
+} ;
+
+/* Standard output, for the print statement. */
+extern Printer fcalOut ;
+
+template <class T> Printer& Printer::operator<< ( const TypedMatrix<T> &m ) {
+  if (format == Binary)
+    {
+      int size[2] = { m.rows, m.cols };
+      put("FCM1", 4);
+      put((const char *) size, sizeof(size));
+      std::vector<float> row(m.cols);
+      for (int i = 0; i < m.rows; i++)
+        {
+          for (int j = 0; j < m.cols; j++)
+            row[j] = (float) *m.access(i, j);
+          put((const char *) row.data(), m.cols * sizeof(float));
+        }
+      return *this;
+    }
+  *this << m.rows << " " << m.cols << "\n";
+  for (int i = 0; i < m.rows; i++)
+    {
+      for (int j = 0; j < m.cols; j++)
+        *this << +*m.access(i, j) << "  ";
+      put("\n", 1);
+    }
+  return *this;
+}
+
+template <class M> Printer& Printer::operator<< ( const CubeView<M> &c ) {
+  *this << c.extents[0] << " " << c.extents[1] << " " << c.extents[2] << "\n";
+  for (int i = 0; i < c.extents[0]; i++)
+    {
+      for (int j = 0; j < c.extents[1]; j++)
+        {
+          for (int k = 0; k < c.extents[2]; k++)
+            *this << *c.access(i, j, k) << "  ";
+          put("\n", 1);
+        }
+      put("\n", 1);
+    }
+  return *this;
+}
+
+/* Sums of m[0..i-1, 0..j-1] for every (i, j), accumulated in double, so
+   that the sum over any rectangle of m is found with four lookups. */
+class SummedAreaTable {
+ public:
+  /* M is Matrix or TriangularMatrix. */
+  template <class M> explicit SummedAreaTable ( M &m ) ;
+
+  /* Sum of m[r, c] for r0 <= r <= r1 and c0 <= c <= c1.  The ranges are
+     clipped to the matrix; an empty range sums to 0. */
+  double rect ( int r0, int r1, int c0, int c1 ) const ;
+
+ private:
+  int rows ;
+  int cols ;
+  std::vector<double> sums ; // (rows + 1) x (cols + 1), row-major
+} ;
+
+template <class M> SummedAreaTable::SummedAreaTable (M &m)
+  : rows(m.numRows()), cols(m.numCols()), sums((rows + 1) * (cols + 1), 0.0)
+{
+  int width = cols + 1;
+  for (int i = 0; i < rows; i++)
+    {
+      double rowSum = 0.0;
+      for (int j = 0; j < cols; j++)
+	{
+	  rowSum += m.at(i, j);
+	  sums[(i + 1) * width + j + 1] = sums[i * width + j + 1] + rowSum;
+	}
+    }
+}
+
+/* A matrix of which only one triangle is stored, packed row by row.
+   The translator emits it for comprehensions such as
+       Matrix c[n, n] i, j = if j <= i then 0.0 else ... ;
+   whose other triangle is a constant.  It reads like a Matrix that is
+   never written outside its stored triangle.
+
+   Upper stores the cells with j - i >= shift, Lower those with
+   i - j >= shift.  The others read as fill, or, when symmetric, as the
+   stored cell (j, i). */
+class TriangularMatrix {
+ public:
+  enum Half { Upper, Lower } ;
+
+  TriangularMatrix ( int _rows, int _cols, Half half, int shift, float fill,
+                     bool _symmetric = false ) ;
+  ~TriangularMatrix () ;
+
+  int numRows ( ) ;
+  int numCols ( ) ;
+
+  /* Stored columns of row i, empty when firstCol(i) > lastCol(i). */
+  int firstCol ( int i ) const { return first[i]; }
+  int lastCol ( int i ) const { return last[i]; }
+
+  float *access ( const int i, const int j ) const {
+    if (j < first[i] || j > last[i])
+      return symmetric ? cells + offset[j] + i : &fillCell;
+    return cells + offset[i] + j;
+  }
+  float &at ( const int i, const int j ) {
+    AccessPolicy::check(i, j, rows, cols);
+    return *access(i, j);
+  }
+  const float &at ( const int i, const int j ) const {
+    AccessPolicy::check(i, j, rows, cols);
+    return *access(i, j);
+  }
+  float &checkedAt ( const int i, const int j, int line, const char *text ) {
+    if (i < 0 || i >= rows || j < 0 || j >= cols)
+      CheckedAccess::boundsError(i, j, rows, cols, line, text);
+    return *access(i, j);
+  }
+
+  /* As for Matrix. */
+  const SummedAreaTable &prefixSums ( ) ;
+  double rowSum ( int i, int c0, int c1 ) const ;
+  float rowMax ( int i, int c0, int c1, float init ) const ;
+  float rowMin ( int i, int c0, int c1, float init ) const ;
+
+ private:
+  TriangularMatrix ( const TriangularMatrix & ) ;
+  TriangularMatrix &operator= ( const TriangularMatrix & ) ;
+  void split ( int i, int &c0, int &c1, int &s0, int &s1 ) const ;
+
+  int rows ;
+  int cols ;
+  bool symmetric ;
+  mutable float fillCell ; // what the unstored cells read as
+  int *first ;             // per row, first and last stored column
+  int *last ;
+  long *offset ;           // cell (i, j) is cells[offset[i] + j]
+  float *cells ;
+  SummedAreaTable *sums ;  // built by prefixSums
+} ;
+
+/* A matrix of R x C floats held in the object itself, so that small
+   matrices live on the stack and loops over them, whose bounds are
+   then constants, can be unrolled.  The translator emits it for
+   comprehensions whose dimensions fold to small constants. */
+template <int R, int C>
+class FixedMatrix {
+ public:
+  FixedMatrix () : sums(NULL) { }
+  ~FixedMatrix () { delete sums; }
+
+  int numRows ( ) { return R; }
+  int numCols ( ) { return C; }
+
+  float *access ( const int i, const int j ) const { return &cells[i][j]; }
+  float &at ( const int i, const int j ) {
+    AccessPolicy::check(i, j, R, C);
+    return cells[i][j];
+  }
+  const float &at ( const int i, const int j ) const {
+    AccessPolicy::check(i, j, R, C);
+    return cells[i][j];
+  }
+  float &checkedAt ( const int i, const int j, int line, const char *text ) {
+    if (i < 0 || i >= R || j < 0 || j >= C)
+      CheckedAccess::boundsError(i, j, R, C, line, text);
+    return cells[i][j];
+  }
+
+  /* As for Matrix. */
+  const SummedAreaTable &prefixSums ( ) {
+    if (sums == NULL)
+      sums = new SummedAreaTable(*this);
+    return *sums;
+  }
+  double rowSum ( int i, int a, int b ) const {
+    return clip(a, b) ? sumKernel(cells[i] + a, b - a + 1) : 0.0;
+  }
+  float rowMax ( int i, int a, int b, float init ) const {
+    return clip(a, b) ? maxKernel(cells[i] + a, b - a + 1, init) : init;
+  }
+  float rowMin ( int i, int a, int b, float init ) const {
+    return clip(a, b) ? minKernel(cells[i] + a, b - a + 1, init) : init;
+  }
+
+ private:
+  FixedMatrix ( const FixedMatrix & ) ;
+  FixedMatrix &operator= ( const FixedMatrix & ) ;
+  static bool clip ( int &a, int &b ) {
+    if (a < 0) a = 0;
+    if (b > C - 1) b = C - 1;
+    return a <= b;
+  }
+
+  mutable float cells[R][C] ;
+  SummedAreaTable *sums ; // built by prefixSums
+} ;
+
+/* A read-only view of another matrix, of type M, whose cell (i, j) is
+   cell (r0 + ri * i + rj * j, c0 + ci * i + cj * j) of the base.  The
+   translator emits it instead of copying comprehensions such as
+       Matrix t[c, r] i, j = m[j, i] ;
+   so reshapes, transposes and blocks cost no memory or fill loop.  The
+   base must outlive the view and must not change while it is used. */
+template <class M>
+class MatrixView {
+ public:
+  MatrixView ( M &_base, int _rows, int _cols,
+               int _r0, int _ri, int _rj, int _c0, int _ci, int _cj )
+    : base(_base), rows(_rows), cols(_cols), r0(_r0), ri(_ri), rj(_rj),
+      c0(_c0), ci(_ci), cj(_cj), sums(NULL) { }
+  ~MatrixView () { delete sums; }
+
+  int numRows ( ) { return rows; }
+  int numCols ( ) { return cols; }
+
+  float *access ( const int i, const int j ) const {
+    return base.access(r0 + ri * i + rj * j, c0 + ci * i + cj * j);
+  }
+  float &at ( const int i, const int j ) {
+    AccessPolicy::check(i, j, rows, cols);
+    return *access(i, j);
+  }
+  const float &at ( const int i, const int j ) const {
+    AccessPolicy::check(i, j, rows, cols);
+    return *access(i, j);
+  }
+  float &checkedAt ( const int i, const int j, int line, const char *text ) {
+    if (i < 0 || i >= rows || j < 0 || j >= cols)
+      CheckedAccess::boundsError(i, j, rows, cols, line, text);
+    return base.checkedAt(r0 + ri * i + rj * j, c0 + ci * i + cj * j,
+                          line, text);
+  }
+
+  /* As for Matrix.  Rows of the view that are runs of one row of the
+     base use the base's kernels. */
+  const SummedAreaTable &prefixSums ( ) {
+    if (sums == NULL)
+      sums = new SummedAreaTable(*this);
+    return *sums;
+  }
+  double rowSum ( int i, int a, int b ) const {
+    if (!clip(a, b)) return 0.0;
+    if (rj == 0 && cj == 1)
+      return base.rowSum(r0 + ri * i, c0 + ci * i + a, c0 + ci * i + b);
+    double s = 0.0;
+    for (int j = a; j <= b; j++) s += *access(i, j);
+    return s;
+  }
+  float rowMax ( int i, int a, int b, float init ) const {
+    if (!clip(a, b)) return init;
+    if (rj == 0 && cj == 1)
+      return base.rowMax(r0 + ri * i, c0 + ci * i + a, c0 + ci * i + b, init);
+    for (int j = a; j <= b; j++) init = init < *access(i, j) ? *access(i, j) : init;
+    return init;
+  }
+  float rowMin ( int i, int a, int b, float init ) const {
+    if (!clip(a, b)) return init;
+    if (rj == 0 && cj == 1)
+      return base.rowMin(r0 + ri * i, c0 + ci * i + a, c0 + ci * i + b, init);
+    for (int j = a; j <= b; j++) init = *access(i, j) < init ? *access(i, j) : init;
+    return init;
+  }
+
+ private:
+  MatrixView ( const MatrixView & ) ;
+  MatrixView &operator= ( const MatrixView & ) ;
+  /* Clips columns a to b to the view; false when nothing is left. */
+  bool clip ( int &a, int &b ) const {
+    if (a < 0) a = 0;
+    if (b > cols - 1) b = cols - 1;
+    return a <= b;
+  }
+
+  M &base ;
+  int rows, cols ;
+  int r0, ri, rj ;
+  int c0, ci, cj ;
+  SummedAreaTable *sums ; // built by prefixSums
 } ;
 
 #endif // MATRIX_H
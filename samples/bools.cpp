@@ -0,0 +1,47 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 4 ,6 ) ; 
+for (int i = 0;i < 4 ; i ++ ) { 
+		for (int j = 0;j < 6 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( (i * 6 )  + j) 	;} } 
+bool cloudy ; 
+bool valid ; 
+int i ; 
+int j ; 
+int count ; 
+cloudy = true  ; 
+valid = false  ; 
+fcalOut <<  (cloudy && ! (valid) )  ; 
+fcalOut << " "  ; 
+fcalOut <<  (valid || false )  ; 
+fcalOut << " "  ; 
+fcalOut <<  ( ( (1  < 2 )  &&  (3  < 2 ) )  ||  (4  <= 4 ) )  ; 
+fcalOut << "\n"  ; 
+count = 0  ; 
+for (i = 0 ; i <= 3 ; i ++ ){ 
+for (j = 0 ; j <= 5 ; j ++ ){ 
+cloudy =  (*(m.access(i, j))  > 10 )  ; 
+valid =  ( (*(m.access(i, j))  < 20 )  ||  (i == 0 ) )  ; 
+if ( ( (cloudy && valid)  ||  ( (j == 5 )  &&  (i == 3 ) ) ) ) count =  (count + 1 )  ; 
+  } 
+  } 
+fcalOut << count ; 
+fcalOut << "\n"  ; 
+i = 0  ; 
+if ( ( (i != 0 )  &&  ( (10  / i)  > 1 ) ) ) fcalOut << "divided"  ; 
+if ( ( (i == 0 )  ||  ( (10  / i)  > 1 ) ) ) fcalOut << "skipped"  ; 
+fcalOut << "\n"  ; 
+bool both ; 
+both = ( (valid) ? (false ) : cloudy ) ; 
+while (both ){ 
+fcalOut << "once\n"  ; 
+both = false  ; 
+  } 
+fcalOut <<  (! (cloudy)  && valid)  ; 
+fcalOut << " "  ; 
+fcalOut <<  (! (valid)  || cloudy)  ; 
+fcalOut << "\n"  ; 
+  
+}
+
@@ -0,0 +1,13 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 2 ,3 ) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < 3 ; j ++ ) { 
+ 	*(m.access(i, j)) =  (i + j) 	;} } 
+int k ; 
+k = 3  ; 
+fcalOut << m.checkedAt(1 , k, 8, "m [1  , k ]")  ; 
+  
+}
+
@@ -0,0 +1,50 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix a( 3 ,5 ) ; 
+for (int i = 0;i < 3 ; i ++ ) { 
+		for (int j = 0;j < 5 ; j ++ ) { 
+ 	*(a.access(i, j)) =  ( (i * 5 )  + j) 	;} } 
+Matrix b( 3 ,5 ) ; 
+for (int i = 0;i < 3 ; i ++ ) { 
+		for (int j = 0;j < 5 ; j ++ ) { 
+ 	*(b.access(i, j)) =  (2  - j) 	;} } 
+fcalOut << Matrix::map (a , [&] (float x) -> float { return  ( (x * x)  - 1 )  ; } , true)  ; 
+fcalOut << Matrix::zip (a , b , [&] (float x, float y) -> float { return  ( (x * y)  + y)  ; } , true)  ; 
+fcalOut << Matrix::filter (a , [&] (float x) -> bool { return  (x > 6 )  ; } , true)  ; 
+fcalOut << Matrix::fold (a , Matrix::FoldSum)  ; 
+fcalOut << "\n"  ; 
+fcalOut << Matrix::fold (b , Matrix::FoldProduct)  ; 
+fcalOut << "\n"  ; 
+fcalOut << Matrix::foldRows (a , Matrix::FoldMax)  ; 
+fcalOut << Matrix::foldCols (b , Matrix::FoldMin)  ; 
+fcalOut << Matrix::map (b , [&] (float x) -> float { return ({float h ; 
+h =  (x * x)  ; 
+   (h - x) ; })   ; } , false)  ; 
+Matrix c( Matrix::map (Matrix::filter (a , [&] (float y) -> bool { return  (y < 10 )  ; } , true)  , [&] (float x) -> float { return  (x / 2 )  ; } , true)  ) ; 
+fcalOut << c ; 
+fcalOut << Matrix::foldCols (Matrix::zip (a , Matrix::map (b , [&] (float z) -> float { return  (z * 3 )  ; } , true)  , [&] (float x, float y) -> float { return  (x - y)  ; } , true)  , Matrix::FoldSum)  ; 
+Matrix big( 300 ,400 ) ; 
+for (int i = 0;i < 300 ; i ++ ) { 
+		for (int j = 0;j < 400 ; j ++ ) { 
+ 	*(big.access(i, j)) =  ( ( (i * 7 )  +  (j * 3 ) )  / 100.0 ) 	;} } 
+float total ; 
+total = Matrix::fold (Matrix::map (big , [&] (float x) -> float { return  (x * 0.5 )  ; } , true)  , Matrix::FoldSum)  ; 
+fcalOut << total ; 
+fcalOut << "\n"  ; 
+fcalOut << Matrix::fold (big , Matrix::FoldMax)  ; 
+fcalOut << "\n"  ; 
+fcalOut << Matrix::fold (Matrix::filter (big , [&] (float x) -> bool { return  (x > 20 )  ; } , true)  , Matrix::FoldSum)  ; 
+fcalOut << "\n"  ; 
+int n ; 
+n = 2  ; 
+FixedMatrix<2, 3> small ; 
+for (int i = 0;i < 2; i ++ ) { 
+		for (int j = 0;j < 3; j ++ ) { 
+ 	*(small.access(i, j)) =  ( (i * 3 )  + j) 	;} } 
+fcalOut << *(small.access(1 , 2 ))  ; 
+fcalOut << "\n"  ; 
+fcalOut << Matrix::map (a , [&] (float n) -> float { return  (n / 4 )  ; } , true)  ; 
+  
+}
+
@@ -0,0 +1,46 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix data( 4 ,12 ) ; 
+for (int p = 0;p < 4 ; p ++ ) { 
+		for (int t = 0;t < 12 ; t ++ ) { 
+ 	*(data.access(p, t)) =  ( (p * 10 )  + t) 	;} } 
+Cube series = Cube::build(4 , 3 , 4 , [&] (int p, int y, int s) -> float { return data.checkedAt(p,  ( (y * 4 )  + s) , 8, "data [p , y * 4  + s ]")  ; }) ; 
+fcalOut << series.checkedExtent(0 , 10, "extent (series , 0 )") ; 
+fcalOut << " "  ; 
+fcalOut << series.checkedExtent(1 , 12, "extent (series , 1 )") ; 
+fcalOut << " "  ; 
+fcalOut << series.checkedExtent(2 , 14, "extent (series , 2 )") ; 
+fcalOut << "\n"  ; 
+Matrix yearly( 4 ,3 ) ; 
+for (int p = 0;p < 4 ; p ++ ) { 
+		for (int y = 0;y < 3 ; y ++ ) { 
+ 	*(yearly.access(p, y)) = 0 	;} } 
+int p ; 
+int y ; 
+int s ; 
+for (p = 0 ; p <= 3 ; p ++ ){ 
+for (y = 0 ; y <= 2 ; y ++ ){ 
+for (s = 0 ; s <= 3 ; s ++ ){ 
+yearly.checkedAt(p, y, 24, "yearly[p,y]") =  (yearly.checkedAt(p, y, 24, "yearly [p , y ]")  + series.checkedAt(p, y, s, 24, "series [p , y , s ]") )  ;  } 
+yearly.checkedAt(p, y, 26, "yearly[p,y]") =  (yearly.checkedAt(p, y, 26, "yearly [p , y ]")  / 4 )  ;  } 
+  } 
+fcalOut << yearly ; 
+series.checkedAt(3 , 2 , 3 , 31, "series[3 ,2 ,3 ]") =  (0  - 1 )  ;fcalOut <<  (series.checkedAt(3 , 2 , 3 , 32, "series [3  , 2  , 3  ]")  + series.checkedAt(0 , 1 , 2 , 32, "series [0  , 1  , 2  ]") )  ; 
+fcalOut << "\n"  ; 
+Cube small = Cube::build(2 , 2 , 3 , [&] (int i, int j, int k) -> float { return  ( ( (i * 100 )  +  (j * 10 ) )  + k)  ; }) ; 
+fcalOut << small ; 
+CubeView<decltype(data)> seasons( data, 4 , 3 , 4 ) ; 
+Cube bands = Cube::rowsOf(data, 4 , 2 , 6 , Cube::FirstFastest) ; 
+Cube doubled = Cube::rowsOf(Matrix( (data * 2 ) ), 4 , 3 , 4 ) ; 
+fcalOut << seasons.checkedAt(2 , 1 , 3 , 43, "seasons [2  , 1  , 3  ]")  ; 
+fcalOut << " "  ; 
+fcalOut << bands.checkedAt(1 , 1 , 5 , 45, "bands [1  , 1  , 5  ]")  ; 
+fcalOut << " "  ; 
+fcalOut << doubled.checkedAt(3 , 2 , 3 , 47, "doubled [3  , 2  , 3  ]")  ; 
+fcalOut << "\n"  ; 
+Cube firstFastest = Cube::build(2 , 2 , 3 , [&] (int i, int j, int k) -> float { return  ( ( (i * 100 )  +  (j * 10 ) )  + k)  ; }, Cube::FirstFastest) ; 
+fcalOut << firstFastest ; 
+  
+}
+
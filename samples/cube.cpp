@@ -0,0 +1,46 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix data( 4 ,12 ) ; 
+for (int p = 0;p < 4 ; p ++ ) { 
+		for (int t = 0;t < 12 ; t ++ ) { 
+ 	*(data.access(p, t)) =  ( (p * 10 )  + t) 	;} } 
+Cube series = Cube::build(4 , 3 , 4 , [&] (int p, int y, int s) -> float { return *(data.access(p,  ( (y * 4 )  + s) ))  ; }) ; 
+fcalOut << series.extent(0 ) ; 
+fcalOut << " "  ; 
+fcalOut << series.extent(1 ) ; 
+fcalOut << " "  ; 
+fcalOut << series.extent(2 ) ; 
+fcalOut << "\n"  ; 
+Matrix yearly( 4 ,3 ) ; 
+for (int p = 0;p < 4 ; p ++ ) { 
+		for (int y = 0;y < 3 ; y ++ ) { 
+ 	*(yearly.access(p, y)) = 0 	;} } 
+int p ; 
+int y ; 
+int s ; 
+for (p = 0 ; p <= 3 ; p ++ ){ 
+for (y = 0 ; y <= 2 ; y ++ ){ 
+for (s = 0 ; s <= 3 ; s ++ ){ 
+*(yearly.access(p, y)) =  (*(yearly.access(p, y))  + *(series.access(p, y, s)) )  ;  } 
+*(yearly.access(p, y)) =  (*(yearly.access(p, y))  / 4 )  ;  } 
+  } 
+fcalOut << yearly ; 
+*(series.access(3 , 2 , 3 )) =  (0  - 1 )  ;fcalOut <<  (*(series.access(3 , 2 , 3 ))  + *(series.access(0 , 1 , 2 )) )  ; 
+fcalOut << "\n"  ; 
+Cube small = Cube::build(2 , 2 , 3 , [&] (int i, int j, int k) -> float { return  ( ( (i * 100 )  +  (j * 10 ) )  + k)  ; }) ; 
+fcalOut << small ; 
+CubeView<decltype(data)> seasons( data, 4 , 3 , 4 ) ; 
+Cube bands = Cube::rowsOf(data, 4 , 2 , 6 , Cube::FirstFastest) ; 
+Cube doubled = Cube::rowsOf(Matrix( (data * 2 ) ), 4 , 3 , 4 ) ; 
+fcalOut << *(seasons.access(2 , 1 , 3 ))  ; 
+fcalOut << " "  ; 
+fcalOut << *(bands.access(1 , 1 , 5 ))  ; 
+fcalOut << " "  ; 
+fcalOut << *(doubled.access(3 , 2 , 3 ))  ; 
+fcalOut << "\n"  ; 
+Cube firstFastest = Cube::build(2 , 2 , 3 , [&] (int i, int j, int k) -> float { return  ( ( (i * 100 )  +  (j * 10 ) )  + k)  ; }, Cube::FirstFastest) ; 
+fcalOut << firstFastest ; 
+  
+}
+
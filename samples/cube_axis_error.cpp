@@ -0,0 +1,11 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Cube c = Cube::build(2 , 3 , 4 , [&] (int i, int j, int k) -> float { return  ( (i + j)  + k)  ; }) ; 
+int axis ; 
+for (axis = 0 ; axis <= 3 ; axis ++ ){ 
+fcalOut << c.checkedExtent(axis, 9, "extent (c , axis)") ; 
+  } 
+  
+}
+
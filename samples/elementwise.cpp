@@ -0,0 +1,34 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix a( 3 ,12 ) ; 
+for (int i = 0;i < 3 ; i ++ ) { 
+		for (int j = 0;j < 12 ; j ++ ) { 
+ 	*(a.access(i, j)) =  (i + j) 	;} } 
+Matrix b( 3 ,12 ) ; 
+for (int i = 0;i < 3 ; i ++ ) { 
+		for (int j = 0;j < 12 ; j ++ ) { 
+ 	*(b.access(i, j)) =  (j -  (2  * i) ) 	;} } 
+Matrix c( 3 ,12 ) ; 
+for (int i = 0;i < 3 ; i ++ ) { 
+		for (int j = 0;j < 12 ; j ++ ) { 
+ 	*(c.access(i, j)) = 0.5 	;} } 
+Matrix d(  (a +  (b * c) )  ) ; 
+fcalOut << d ; 
+d =  ( (d - 1 )  / 2 )  ; 
+fcalOut << d ; 
+d =  (d * d)  ; 
+fcalOut << d ; 
+fcalOut <<  (a > b)  ; 
+fcalOut <<  (a ==  (b +  (6  * c) ) )  ; 
+fcalOut <<  (3  <= a)  ; 
+Matrix f( 12 ,2 ) ; 
+for (int i = 0;i < 12 ; i ++ ) { 
+		for (int j = 0;j < 2 ; j ++ ) { 
+ 	*(f.access(i, j)) =  ( (i * j)  + 1 ) 	;} } 
+Matrix g(  ( (Matrix::multiply  ( (a - b)  , f ) * *(c.access(0 , 0 )) )  - Matrix::multiply  (b , f ))  ) ; 
+fcalOut << g ; 
+fcalOut <<  (Matrix::multiply  ( (a * 2 )  , f ) + 1 )  ; 
+  
+}
+
@@ -0,0 +1,15 @@
+/* fcalrt.h: everything a translated FCAL program includes.
+
+   The translator emits a single include of this header so that it can
+   be precompiled once (fcalrt.h.gch) instead of re-parsing <iostream>
+   and Matrix.h for every generated program.  Build the precompiled
+   header and libfcalrt with "make runtime" in src.
+*/
+#ifndef FCALRT_H
+#define FCALRT_H
+
+#include <iostream>
+#include "Matrix.h"
+#include <math.h>
+
+#endif // FCALRT_H
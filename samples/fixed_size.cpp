@@ -0,0 +1,49 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int w ; 
+w = 7  ; 
+int n ; 
+n = 2  ; 
+n =  (n + 1 )  ; 
+Matrix a( 3 ,w) ; 
+for (int i = 0;i < 3 ; i ++ ) { 
+		for (int j = 0;j < w; j ++ ) { 
+ 	*(a.access(i, j)) =  ( (i * w)  + j) 	;} } 
+Matrix b(  (2  * 2 ) , (w - 4 ) ) ; 
+for (int i = 0;i <  (2  * 2 ) ; i ++ ) { 
+		for (int j = 0;j <  (w - 4 ) ; j ++ ) { 
+ 	*(b.access(i, j)) =  (*(a.access( (i -  ( (i / 3 )  * 3 ) ) , j))  * 2 ) 	;} } 
+Matrix c( n,2 ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = 0;j < 2 ; j ++ ) { 
+ 	*(c.access(i, j)) =  (i - j) 	;} } 
+Matrix d( 2 ,2 ) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < 2 ; j ++ ) { 
+ 	*(d.access(i, j)) =  (*(b.access(i, j))  + *(a.access(j, i)) ) 	;} } 
+int i ; 
+int j ; 
+float s ; 
+for (i = 0 ; i <=  (b.numRows() - 1 ) ; i ++ ){ 
+s = 0.0  ; 
+for (j = 0 ; j <=  (a.numCols() - 1 ) ; j ++ ){ 
+s =  (s + *(a.access( (i / 2 ) , j)) )  ; 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+for (j = 0 ; j <=  (b.numCols() - 1 ) ; j ++ ){ 
+fcalOut << *(b.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+fcalOut <<  (*(c.access(i, 0 ))  + *(c.access(i, 1 )) )  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+fcalOut << d ; 
+  
+}
+
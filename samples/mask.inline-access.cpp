@@ -0,0 +1,40 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix data( 5 ,70 ) ; 
+for (int i = 0;i < 5 ; i ++ ) { 
+		for (int j = 0;j < 70 ; j ++ ) { 
+ 	data.at(i, j) =  ( ( (i * 70 )  + j)  / 10.0 ) 	;} } 
+Mask cloud(  (data > 20 )  ) ; 
+Mask nodata = Mask::build(5 , 70 , [&] (int i, int j) -> bool { return  ( (j == 3 )  ||  (j > 65 ) )  ; }) ; 
+Mask clear(  (! (cloud)  && ! (nodata) )  ) ; 
+fcalOut << cloud.count() ; 
+fcalOut << " "  ; 
+fcalOut << nodata.count() ; 
+fcalOut << " "  ; 
+fcalOut << clear.count() ; 
+fcalOut << " "  ; 
+fcalOut <<  (cloud || nodata) .count() ; 
+fcalOut << " "  ; 
+fcalOut <<  (clear.numRows() * clear.numCols())  ; 
+fcalOut << "\n"  ; 
+int i ; 
+int j ; 
+float total ; 
+total = 0  ; 
+for (i = 0 ; i <= 4 ; i ++ ){ 
+for (j = 0 ; j <= 69 ; j ++ ){ 
+if (clear.at(i, j) ) total =  (total + data.at(i, j) )  ; 
+  } 
+  } 
+fcalOut << total ; 
+fcalOut << "\n"  ; 
+clear.at(0 , 0 ) = false  ;clear.at(4 , 69 ) = true  ;fcalOut << clear.at(0 , 0 )  ; 
+fcalOut << clear.at(4 , 69 )  ; 
+fcalOut << "\n"  ; 
+Mask small = Mask::build(2 , 3 , [&] (int i, int j) -> bool { return  (i == j)  ; }) ; 
+fcalOut << small ; 
+fcalOut << ! (small)  ; 
+  
+}
+
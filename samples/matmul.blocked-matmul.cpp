@@ -0,0 +1,66 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix a( 5 ,20 ) ; 
+for (int i = 0;i < 5 ; i ++ ) { 
+		for (int j = 0;j < 20 ; j ++ ) { 
+ 	*(a.access(i, j)) =  ( (i + j)  - 7 ) 	;} } 
+Matrix b( 20 ,9 ) ; 
+for (int i = 0;i < 20 ; i ++ ) { 
+		for (int j = 0;j < 9 ; j ++ ) { 
+ 	*(b.access(i, j)) =  ( (i * j)  - 10 ) 	;} } 
+Matrix e( 9 ,2 ) ; 
+for (int i = 0;i < 9 ; i ++ ) { 
+		for (int j = 0;j < 2 ; j ++ ) { 
+ 	*(e.access(i, j)) =  (i - j) 	;} } 
+Matrix c( Matrix::multiply  (a , b ) ) ; 
+fcalOut << c ; 
+fcalOut << Matrix::multiply  (Matrix::multiply  (a , b ) , e ) ; 
+Matrix d( 5 ,9 ) ; 
+for (int i = 0;i < 5 ; i ++ ) { 
+		for (int j = 0;j < 9 ; j ++ ) { 
+ 	*(d.access(i, j)) = 1 	;} } 
+int i ; 
+int j ; 
+int k ; 
+{ int lo1_ = 2 , hi1_ = 19 , lo2_ = 1 , hi2_ = 4 , lo3_ = 0 , hi3_ = 8  ; 
+Matrix::multiplyAdd(d, a, b, lo2_, hi2_, lo3_, hi3_, lo1_, hi1_) ; 
+if (lo1_ <= hi1_) { if (lo2_ <= hi2_) j = (lo3_ <= hi3_) ? hi3_ + 1 : lo3_ ; 
+i = (lo2_ <= hi2_) ? hi2_ + 1 : lo2_ ; } 
+k = (lo1_ <= hi1_) ? hi1_ + 1 : lo1_ ; } 
+fcalOut << d ; 
+fcalOut << i ; 
+fcalOut << " "  ; 
+fcalOut << j ; 
+fcalOut << " "  ; 
+fcalOut << k ; 
+fcalOut << "\n"  ; 
+Matrix p( 120 ,130 ) ; 
+for (int i = 0;i < 120 ; i ++ ) { 
+		for (int j = 0;j < 130 ; j ++ ) { 
+ 	*(p.access(i, j)) =  ( ( ( (i * 3 )  + j)  / 7 )  - 20 ) 	;} } 
+Matrix q( 130 ,110 ) ; 
+for (int i = 0;i < 130 ; i ++ ) { 
+		for (int j = 0;j < 110 ; j ++ ) { 
+ 	*(q.access(i, j)) =  ( ( (i +  (j * 5 ) )  / 11 )  - 30 ) 	;} } 
+Matrix r( 120 ,110 ) ; 
+for (int i = 0;i < 120 ; i ++ ) { 
+		for (int j = 0;j < 110 ; j ++ ) { 
+ 	*(r.access(i, j)) = 0 	;} } 
+{ int lo1_ = 0 , hi1_ = 119 , lo2_ = 0 , hi2_ = 109 , lo3_ = 0 , hi3_ = 129  ; 
+Matrix::multiplyAdd(r, p, q, lo1_, hi1_, lo2_, hi2_, lo3_, hi3_) ; 
+if (lo1_ <= hi1_) { if (lo2_ <= hi2_) k = (lo3_ <= hi3_) ? hi3_ + 1 : lo3_ ; 
+j = (lo2_ <= hi2_) ? hi2_ + 1 : lo2_ ; } 
+i = (lo1_ <= hi1_) ? hi1_ + 1 : lo1_ ; } 
+float s ; 
+s = 0.0  ; 
+for (i = 0 ; i <= 119 ; i ++ ){ 
+for (j = 0 ; j <= 109 ; j ++ ){ 
+s =  (s +  (*(r.access(i, j))  / 1000 ) )  ; 
+  } 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  
+}
+
@@ -0,0 +1,68 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix a( 5 ,20 ) ; 
+for (int i = 0;i < 5 ; i ++ ) { 
+		for (int j = 0;j < 20 ; j ++ ) { 
+ 	*(a.access(i, j)) =  ( (i + j)  - 7 ) 	;} } 
+Matrix b( 20 ,9 ) ; 
+for (int i = 0;i < 20 ; i ++ ) { 
+		for (int j = 0;j < 9 ; j ++ ) { 
+ 	*(b.access(i, j)) =  ( (i * j)  - 10 ) 	;} } 
+Matrix e( 9 ,2 ) ; 
+for (int i = 0;i < 9 ; i ++ ) { 
+		for (int j = 0;j < 2 ; j ++ ) { 
+ 	*(e.access(i, j)) =  (i - j) 	;} } 
+Matrix c( Matrix::multiply  (a , b ) ) ; 
+fcalOut << c ; 
+fcalOut << Matrix::multiply  (Matrix::multiply  (a , b ) , e ) ; 
+Matrix d( 5 ,9 ) ; 
+for (int i = 0;i < 5 ; i ++ ) { 
+		for (int j = 0;j < 9 ; j ++ ) { 
+ 	*(d.access(i, j)) = 1 	;} } 
+int i ; 
+int j ; 
+int k ; 
+for (k = 2 ; k <= 19 ; k ++ ){ 
+for (i = 1 ; i <= 4 ; i ++ ){ 
+for (j = 0 ; j <= 8 ; j ++ ){ 
+*(d.access(i, j)) =  (*(d.access(i, j))  +  (*(b.access(k, j))  * *(a.access(i, k)) ) )  ;  } 
+  } 
+  } 
+fcalOut << d ; 
+fcalOut << i ; 
+fcalOut << " "  ; 
+fcalOut << j ; 
+fcalOut << " "  ; 
+fcalOut << k ; 
+fcalOut << "\n"  ; 
+Matrix p( 120 ,130 ) ; 
+for (int i = 0;i < 120 ; i ++ ) { 
+		for (int j = 0;j < 130 ; j ++ ) { 
+ 	*(p.access(i, j)) =  ( ( ( (i * 3 )  + j)  / 7 )  - 20 ) 	;} } 
+Matrix q( 130 ,110 ) ; 
+for (int i = 0;i < 130 ; i ++ ) { 
+		for (int j = 0;j < 110 ; j ++ ) { 
+ 	*(q.access(i, j)) =  ( ( (i +  (j * 5 ) )  / 11 )  - 30 ) 	;} } 
+Matrix r( 120 ,110 ) ; 
+for (int i = 0;i < 120 ; i ++ ) { 
+		for (int j = 0;j < 110 ; j ++ ) { 
+ 	*(r.access(i, j)) = 0 	;} } 
+for (i = 0 ; i <= 119 ; i ++ ){ 
+for (j = 0 ; j <= 109 ; j ++ ){ 
+for (k = 0 ; k <= 129 ; k ++ ){ 
+*(r.access(i, j)) =  (*(r.access(i, j))  +  (*(p.access(i, k))  * *(q.access(k, j)) ) )  ;  } 
+  } 
+  } 
+float s ; 
+s = 0.0  ; 
+for (i = 0 ; i <= 119 ; i ++ ){ 
+for (j = 0 ; j <= 109 ; j ++ ){ 
+s =  (s +  (*(r.access(i, j))  / 1000 ) )  ; 
+  } 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  
+}
+
@@ -0,0 +1,29 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m1( Matrix::readMatrix  ("../samples/my_code_1a.data"  ) ) ; 
+Matrix m2( Matrix::readMatrix  ("../samples/my_code_1b.data"  ) ) ; 
+int rows1 ; 
+rows1 = m1.numRows() ; 
+int cols1 ; 
+cols1 = m1.numCols() ; 
+int rows2 ; 
+rows2 = m2.numRows() ; 
+int cols2 ; 
+cols2 = m2.numCols() ; 
+Matrix output( rows1,cols2) ; 
+for (int rows = 0;rows < rows1; rows ++ ) { 
+		for (int cols = 0;cols < cols2; cols ++ ) { 
+ 	*(output.access(rows, cols)) = 0 	;} } 
+int i ; 
+int j ; 
+int k ; 
+{ int lo1_ = 0 , hi1_ =  (rows1 - 1 ) , lo2_ = 0 , hi2_ =  (cols1 - 1 ) , lo3_ = 0 , hi3_ =  (cols2 - 1 )  ; 
+Matrix::multiplyAdd(output, m1, m2, lo1_, hi1_, lo2_, hi2_, lo3_, hi3_) ; 
+if (lo1_ <= hi1_) { if (lo2_ <= hi2_) k = (lo3_ <= hi3_) ? hi3_ + 1 : lo3_ ; 
+j = (lo2_ <= hi2_) ? hi2_ + 1 : lo2_ ; } 
+i = (lo1_ <= hi1_) ? hi1_ + 1 : lo1_ ; } 
+fcalOut << output ; 
+  
+}
+
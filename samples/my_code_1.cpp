@@ -0,0 +1,30 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m1( Matrix::readMatrix  ("../samples/my_code_1a.data"  ) ) ; 
+Matrix m2( Matrix::readMatrix  ("../samples/my_code_1b.data"  ) ) ; 
+int rows1 ; 
+rows1 = m1.numRows() ; 
+int cols1 ; 
+cols1 = m1.numCols() ; 
+int rows2 ; 
+rows2 = m2.numRows() ; 
+int cols2 ; 
+cols2 = m2.numCols() ; 
+Matrix output( rows1,cols2) ; 
+for (int rows = 0;rows < rows1; rows ++ ) { 
+		for (int cols = 0;cols < cols2; cols ++ ) { 
+ 	*(output.access(rows, cols)) = 0 	;} } 
+int i ; 
+int j ; 
+int k ; 
+for (i = 0 ; i <=  (rows1 - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (cols1 - 1 ) ; j ++ ){ 
+for (k = 0 ; k <=  (cols2 - 1 ) ; k ++ ){ 
+*(output.access(i, j)) =  (*(output.access(i, j))  +  (*(m1.access(i, k))  * *(m2.access(k, j)) ) )  ;  } 
+  } 
+  } 
+fcalOut << output ; 
+  
+}
+
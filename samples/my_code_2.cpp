@@ -0,0 +1,22 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int previous ; 
+previous = 0  ; 
+int current ; 
+current = 1  ; 
+int next ; 
+next =  (current + previous)  ; 
+int count ; 
+count = 0  ; 
+while ( (count < 10 )  ){ 
+fcalOut << next ; 
+fcalOut << "\n"  ; 
+next =  (current + previous)  ; 
+previous = current ; 
+current = next ; 
+count =  (count + 1 )  ; 
+  } 
+  
+}
+
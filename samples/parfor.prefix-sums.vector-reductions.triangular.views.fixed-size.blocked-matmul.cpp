@@ -0,0 +1,124 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 500 ,300 ) ; 
+for (int i = 0;i < 500 ; i ++ ) { 
+		for (int j = 0;j < 300 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( ( (i * 3 )  +  (j * 7 ) )  / 50.0 ) 	;} } 
+Matrix r( 500 ,1 ) ; 
+for (int i = 0;i < 500 ; i ++ ) { 
+		for (int j = 0;j < 1 ; j ++ ) { 
+ 	*(r.access(i, j)) = 0 	;} } 
+int i ; 
+int j ; 
+int count ; 
+float s ; 
+float big ; 
+float t ; 
+s = 0  ; 
+big = 0  ; 
+count = 0  ; 
+t = 42  ; 
+i = 7  ; 
+{ int first_ = 0 , last_ = 499  ; 
+int parts_ = parforPartCount(first_, last_) ; 
+std::vector<decltype(s)> partials_s_ (parts_, reductionIdentity<decltype(s)>(Matrix::FoldSum)) ; 
+std::vector<decltype(big)> partials_big_ (parts_, reductionIdentity<decltype(big)>(Matrix::FoldMax)) ; 
+std::vector<decltype(count)> partials_count_ (parts_, reductionIdentity<decltype(count)>(Matrix::FoldSum)) ; 
+auto shared_j_ = j ; 
+auto shared_t_ = t ; 
+parforRun(first_, last_, parts_, [&] (int part_, int lo_, int hi_) { 
+auto s = partials_s_[part_] ; 
+auto big = partials_big_[part_] ; 
+auto count = partials_count_[part_] ; 
+auto j = shared_j_ ; 
+auto t = shared_t_ ; 
+int i ; 
+for (i = lo_; i <= hi_; i ++ ){ 
+for (j = 0 ; j <= 299 ; j ++ ){ 
+t =  (*(m.access(i, j))  * 0.5 )  ; 
+*(r.access(i, 0 )) =  (*(r.access(i, 0 ))  + t)  ;s =  (s + t)  ; 
+if ( (t > big) ) big = t ; 
+if ( (t > 20 ) ) count =  (count + 1 )  ; 
+  } 
+  } 
+
+partials_s_[part_] = s ; 
+partials_big_[part_] = big ; 
+partials_count_[part_] = count ; 
+} ) ; 
+s = combinePartials(partials_s_, s, Matrix::FoldSum) ; 
+big = combinePartials(partials_big_, big, Matrix::FoldMax) ; 
+count = combinePartials(partials_count_, count, Matrix::FoldSum) ; 
+} 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << big ; 
+fcalOut << " "  ; 
+fcalOut << count ; 
+fcalOut << " "  ; 
+fcalOut << *(r.access(499 , 0 ))  ; 
+fcalOut << "\n"  ; 
+fcalOut << i ; 
+fcalOut << " "  ; 
+fcalOut << t ; 
+fcalOut << "\n"  ; 
+float p ; 
+float low ; 
+p = 2  ; 
+low = 100  ; 
+{ int first_ = 1 , last_ = 10  ; 
+int parts_ = parforPartCount(first_, last_) ; 
+std::vector<decltype(p)> partials_p_ (parts_, reductionIdentity<decltype(p)>(Matrix::FoldProduct)) ; 
+std::vector<decltype(low)> partials_low_ (parts_, reductionIdentity<decltype(low)>(Matrix::FoldMin)) ; 
+auto shared_j_ = j ; 
+parforRun(first_, last_, parts_, [&] (int part_, int lo_, int hi_) { 
+auto p = partials_p_[part_] ; 
+auto low = partials_low_[part_] ; 
+auto j = shared_j_ ; 
+int i ; 
+for (i = lo_; i <= hi_; i ++ ){ 
+p =  (p * i)  ; 
+{ int first_ = 0 , last_ = i ; 
+int parts_ = parforPartCount(first_, last_) ; 
+std::vector<decltype(low)> partials_low_ (parts_, reductionIdentity<decltype(low)>(Matrix::FoldMin)) ; 
+parforRun(first_, last_, parts_, [&] (int part_, int lo_, int hi_) { 
+auto low = partials_low_[part_] ; 
+int j ; 
+for (j = lo_; j <= hi_; j ++ ){ 
+if ( (*(m.access( (i * 7 ) , j))  < low) ) low = *(m.access( (i * 7 ) , j))  ; 
+  } 
+
+partials_low_[part_] = low ; 
+} ) ; 
+low = combinePartials(partials_low_, low, Matrix::FoldMin) ; 
+} 
+  } 
+
+partials_p_[part_] = p ; 
+partials_low_[part_] = low ; 
+} ) ; 
+p = combinePartials(partials_p_, p, Matrix::FoldProduct) ; 
+low = combinePartials(partials_low_, low, Matrix::FoldMin) ; 
+} 
+fcalOut << p ; 
+fcalOut << " "  ; 
+fcalOut << low ; 
+fcalOut << "\n"  ; 
+{ int first_ = 5 , last_ = 4  ; 
+int parts_ = parforPartCount(first_, last_) ; 
+std::vector<decltype(s)> partials_s_ (parts_, reductionIdentity<decltype(s)>(Matrix::FoldSum)) ; 
+parforRun(first_, last_, parts_, [&] (int part_, int lo_, int hi_) { 
+auto s = partials_s_[part_] ; 
+int i ; 
+for (i = lo_; i <= hi_; i ++ )s =  (s + 1 )  ; 
+
+partials_s_[part_] = s ; 
+} ) ; 
+s = combinePartials(partials_s_, s, Matrix::FoldSum) ; 
+} 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  
+}
+
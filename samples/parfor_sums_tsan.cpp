@@ -0,0 +1,39 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 100 ,10 ) ; 
+for (int i = 0;i < 100 ; i ++ ) { 
+		for (int j = 0;j < 10 ; j ++ ) { 
+ 	*(m.access(i, j)) =  (i + j) 	;} } 
+int i ; 
+int j ; 
+int k ; 
+float area ; 
+area = 0  ; 
+{ int first_ = 0 , last_ = 99  ; 
+m.prefixSums() ; 
+int parts_ = parforPartCount(first_, last_) ; 
+std::vector<decltype(area)> partials_area_ (parts_, reductionIdentity<decltype(area)>(Matrix::FoldSum)) ; 
+auto shared_j_ = j ; 
+auto shared_k_ = k ; 
+parforRun(first_, last_, parts_, [&] (int part_, int lo_, int hi_) { 
+auto area = partials_area_[part_] ; 
+auto j = shared_j_ ; 
+auto k = shared_k_ ; 
+int i ; 
+for (i = lo_; i <= hi_; i ++ ){ 
+{ int b1_ = 0 , b2_ = i, b3_ = 0 , b4_ = 9  ; 
+area = area + m.prefixSums().rect(b1_, b2_, b3_, b4_) ; 
+if (b1_ <= b2_) k = (b3_ <= b4_) ? b4_ + 1 : b3_ ; 
+j = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+  } 
+
+partials_area_[part_] = area ; 
+} ) ; 
+area = combinePartials(partials_area_, area, Matrix::FoldSum) ; 
+} 
+fcalOut << area ; 
+fcalOut << "\n"  ; 
+  
+}
+
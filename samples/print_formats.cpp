@@ -0,0 +1,21 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 2 ,3 ) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < 3 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( (i + 1 )  /  (j + 3.0 ) ) 	;} } 
+fcalOut << m ; 
+float big ; 
+big = 1234567.0  ; 
+fcalOut << big ; 
+fcalOut << " "  ; 
+fcalOut <<  (big * 1000.0 )  ; 
+fcalOut << " "  ; 
+fcalOut <<  (0.0001  / 3.0 )  ; 
+fcalOut << " "  ; 
+fcalOut <<  (0  - 42 )  ; 
+fcalOut << "\n"  ; 
+  
+}
+
@@ -0,0 +1,33 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+QuantizedMatrix band( Matrix::readMatrix  ("../samples/quantized_band.data"  ) ) ; 
+QuantizedMatrix landClass( Matrix::readMatrix  ("../samples/quantized_class.data"  ) ) ; 
+int i ; 
+int j ; 
+float mean ; 
+float bright ; 
+int water ; 
+bright = 0  ; 
+water = 0  ; 
+for (i = 0 ; i <=  (band.numRows() - 1 ) ; i ++ ){ 
+mean = 0  ; 
+for (j = 0 ; j <=  (band.numCols() - 1 ) ; j ++ ){ 
+mean =  (mean + ((float) *(band.access(i, j))) )  ; 
+if ( (((float) *(band.access(i, j)))  > bright) ) bright = ((float) *(band.access(i, j)))  ; 
+if ( ( (((float) *(landClass.access(i, j)))  == 30 )  &&  (((float) *(band.access(i, j)))  < 0.1 ) ) ) water =  (water + 1 )  ; 
+  } 
+if ( ( (i -  ( (i / 10 )  * 10 ) )  == 0 ) ) { 
+fcalOut <<  (mean / band.numCols())  ; 
+fcalOut << "\n"  ; 
+  } 
+  } 
+fcalOut << bright ; 
+fcalOut << " "  ; 
+fcalOut << water ; 
+fcalOut << " "  ; 
+fcalOut <<  (((float) *(band.access(29 , 39 )))  * ((float) *(landClass.access(29 , 39 ))) )  ; 
+fcalOut << "\n"  ; 
+  
+}
+
@@ -0,0 +1,8 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( Matrix::readMatrix  ("../samples/read_error.fcm"  ) ) ; 
+fcalOut << m ; 
+  
+}
+
@@ -0,0 +1,59 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 8 ,6 ) ; 
+for (int i = 0;i < 8 ; i ++ ) { 
+		for (int j = 0;j < 6 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( (i * 6 )  + j) 	;} } 
+int i ; 
+int j ; 
+int k ; 
+float s ; 
+for (k = 0 ; k <= 4 ; k ++ ){ 
+s = 0.0  ; 
+for (i = k; i <=  (k + 3 ) ; i ++ ){ 
+for (j = 1 ; j <= 4 ; j ++ ){ 
+s =  (s + *(m.access(i, j)) )  ; 
+  } 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << i ; 
+fcalOut << " "  ; 
+fcalOut << j ; 
+fcalOut << "\n"  ; 
+  } 
+s = 0.0  ; 
+for (i = 0 ; i <=  (m.numRows() - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (m.numCols() - 1 ) ; j ++ ){ 
+s =  (s + *(m.access(i, j)) )  ; 
+  } 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+s = 5.0  ; 
+for (i = 3 ; i <= 2 ; i ++ ){ 
+for (j = 0 ; j <= 5 ; j ++ ){ 
+s =  (s + *(m.access(i, j)) )  ; 
+  } 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << i ; 
+fcalOut << "\n"  ; 
+Matrix h( 2 ,4 ) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < 4 ; j ++ ) { 
+ 	*(h.access(i, j)) = 0.5 	;} } 
+int n ; 
+n = 0  ; 
+for (i = 0 ; i <= 1 ; i ++ ){ 
+for (j = 0 ; j <= 3 ; j ++ ){ 
+n =  (n + *(h.access(i, j)) )  ; 
+  } 
+  } 
+fcalOut << n ; 
+fcalOut << "\n"  ; 
+  
+}
+
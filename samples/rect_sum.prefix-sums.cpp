@@ -0,0 +1,56 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 8 ,6 ) ; 
+for (int i = 0;i < 8 ; i ++ ) { 
+		for (int j = 0;j < 6 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( (i * 6 )  + j) 	;} } 
+int i ; 
+int j ; 
+int k ; 
+float s ; 
+for (k = 0 ; k <= 4 ; k ++ ){ 
+s = 0.0  ; 
+{ int b1_ = k, b2_ =  (k + 3 ) , b3_ = 1 , b4_ = 4  ; 
+s = s + m.prefixSums().rect(b1_, b2_, b3_, b4_) ; 
+if (b1_ <= b2_) j = (b3_ <= b4_) ? b4_ + 1 : b3_ ; 
+i = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << i ; 
+fcalOut << " "  ; 
+fcalOut << j ; 
+fcalOut << "\n"  ; 
+  } 
+s = 0.0  ; 
+{ int b1_ = 0 , b2_ =  (m.numRows() - 1 ) , b3_ = 0 , b4_ =  (m.numCols() - 1 )  ; 
+s = s + m.prefixSums().rect(b1_, b2_, b3_, b4_) ; 
+if (b1_ <= b2_) j = (b3_ <= b4_) ? b4_ + 1 : b3_ ; 
+i = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+s = 5.0  ; 
+{ int b1_ = 3 , b2_ = 2 , b3_ = 0 , b4_ = 5  ; 
+s = s + m.prefixSums().rect(b1_, b2_, b3_, b4_) ; 
+if (b1_ <= b2_) j = (b3_ <= b4_) ? b4_ + 1 : b3_ ; 
+i = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << i ; 
+fcalOut << "\n"  ; 
+Matrix h( 2 ,4 ) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < 4 ; j ++ ) { 
+ 	*(h.access(i, j)) = 0.5 	;} } 
+int n ; 
+n = 0  ; 
+for (i = 0 ; i <= 1 ; i ++ ){ 
+for (j = 0 ; j <= 3 ; j ++ ){ 
+n =  (n + *(h.access(i, j)) )  ; 
+  } 
+  } 
+fcalOut << n ; 
+fcalOut << "\n"  ; 
+  
+}
+
@@ -0,0 +1,89 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int w ; 
+w = 3  ; 
+Matrix m( 4 ,6 ) ; 
+for (int i = 0;i < 4 ; i ++ ) { 
+		for (int j = 0;j < 6 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( (i * 10 )  + j) 	;} } 
+Matrix t( 6 ,4 ) ; 
+for (int i = 0;i < 6 ; i ++ ) { 
+		for (int j = 0;j < 4 ; j ++ ) { 
+ 	*(t.access(i, j)) = *(m.access(j, i)) 	;} } 
+Matrix block( 2 ,3 ) ; 
+for (int r = 0;r < 2 ; r ++ ) { 
+		for (int c = 0;c < 3 ; c ++ ) { 
+ 	*(block.access(r, c)) = *(m.access( (r + 1 ) ,  ( (c * 2 )  + 1 ) )) 	;} } 
+Matrix rows( 2 ,w) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < w; j ++ ) { 
+ 	*(rows.access(i, j)) = *(m.access(2 ,  ( (i * w)  + j) )) 	;} } 
+Matrix back( 4 ,6 ) ; 
+for (int i = 0;i < 4 ; i ++ ) { 
+		for (int j = 0;j < 6 ; j ++ ) { 
+ 	*(back.access(i, j)) = *(m.access( (3  - i) ,  (5  - j) )) 	;} } 
+Matrix padded( 2 ,4 ) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < 4 ; j ++ ) { 
+ 	*(padded.access(i, j)) = ( ( ( ( (i * 4 )  + j)  >= 6 ) ) ? ( (0.0  - 1 ) ) : *(m.access(1 ,  ( (i * 4 )  + j) ))  )	;} } 
+Matrix n( 2 ,2 ) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < 2 ; j ++ ) { 
+ 	*(n.access(i, j)) = 0 	;} } 
+Matrix nt( 2 ,2 ) ; 
+for (int i = 0;i < 2 ; i ++ ) { 
+		for (int j = 0;j < 2 ; j ++ ) { 
+ 	*(nt.access(i, j)) = *(n.access(j, i)) 	;} } 
+*(n.access(0 , 1 )) = 7  ;int i ; 
+int j ; 
+float s ; 
+fcalOut << t ; 
+for (i = 0 ; i <=  (t.numRows() - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (t.numCols() - 1 ) ; j ++ ){ 
+fcalOut << *(t.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <= 1 ; i ++ ){ 
+for (j = 0 ; j <= 2 ; j ++ ){ 
+fcalOut << *(block.access(i, j))  ; 
+fcalOut << " "  ; 
+fcalOut << *(rows.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+for (j = 0 ; j <= 3 ; j ++ ){ 
+fcalOut << *(padded.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut <<  (*(nt.access(i, 0 ))  + *(nt.access(i, 1 )) )  ; 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <= 3 ; i ++ ){ 
+s = 0.0  ; 
+for (j = 1 ; j <= 4 ; j ++ ){ 
+s =  ( (s + *(back.access(i, j)) )  + *(t.access(j, i)) )  ; 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <= 2 ; i ++ ){ 
+s = 0.0  ; 
+for (j = 0 ; j <= 1 ; j ++ ){ 
+s = ( ( (s < *(rows.access(j, i)) ) ) ? (*(rows.access(j, i)) ) : s ) ; 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <= 1 ; i ++ ){ 
+s = 0.0  ; 
+for (j = 0 ; j <=  (w - 1 ) ; j ++ ){ 
+s =  ( (s + *(rows.access(i, j)) )  - *(back.access(i, j)) )  ; 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  } 
+  
+}
+
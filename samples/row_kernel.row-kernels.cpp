@@ -0,0 +1,91 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int pixels ; 
+pixels = 300  ; 
+int season ; 
+season = 4  ; 
+int years ; 
+years = 6  ; 
+Matrix data( pixels,24 ) ; 
+auto data_kernel = [&] (int p, int t) -> float { return  ( ( ( (p * 37 )  +  (t * 11 ) )  -  ( ( ( (p * 37 )  +  (t * 11 ) )  / 17 )  * 17 ) )  + ( ( ( (t >= 12 )  &&  ( (p -  ( (p / 3 )  * 3 ) )  == 0 ) ) ) ? ( (0  - 8 ) ) : 0  ))  ; } ; 
+rowKernelRun(data, data_kernel) ; 
+Matrix score( pixels,1 ) ; 
+auto score_kernel = [&] (int row, int unused) -> float { return ({Matrix yearly( years,1 ) ; 
+for (int y = 0;y < years; y ++ ) { 
+		for (int c = 0;c < 1 ; c ++ ) { 
+ 	*(yearly.access(y, c)) = ({float total ; 
+total = 0  ; 
+int s ; 
+for (s = 0 ; s <=  (season - 1 ) ; s ++ ){ 
+total =  (total + *(data.access(row,  ( (y * season)  + s) )) )  ; 
+  } 
+   (total / season) ; })  	;} } 
+float best ; 
+best =  (0  - 1000 )  ; 
+int y ; 
+for (y = 1 ; y <=  (years - 1 ) ; y ++ ){ 
+float before ; 
+float after ; 
+before = 0  ; 
+after = 0  ; 
+int k ; 
+for (k = 0 ; k <=  (y - 1 ) ; k ++ )before =  (before + *(yearly.access(k, 0 )) )  ; 
+for (k = y; k <=  (years - 1 ) ; k ++ )after =  (after + *(yearly.access(k, 0 )) )  ; 
+if ( ( ( (before / y)  -  (after /  (years - y) ) )  > best) ) best =  ( (before / y)  -  (after /  (years - y) ) )  ; 
+  } 
+  best; })   ; } ; 
+rowKernelRun(score, score_kernel) ; 
+Matrix change( pixels,2 ) ; 
+auto change_kernel = [&] (int row, int c) -> float { return  (*(data.access(row,  (23  - c) ))  - *(data.access(row, c)) )  ; } ; 
+rowKernelRun(change, change_kernel) ; 
+Matrix smooth( pixels,1 ) ; 
+for (int row = 0;row < pixels; row ++ ) { 
+		for (int c = 0;c < 1 ; c ++ ) { 
+ 	*(smooth.access(row, c)) =  ( (*(data.access(row, 0 ))  + *(data.access( ( (row + 1 )  -  ( ( (row + 1 )  / pixels)  * pixels) ) , 0 )) )  / 2 ) 	;} } 
+Matrix weights( 24 ,1 ) ; 
+auto weights_kernel = [&] (int t, int c) -> float { return  (t / 24.0 )  ; } ; 
+rowKernelRun(weights, weights_kernel) ; 
+Matrix weighted( pixels,1 ) ; 
+for (int row = 0;row < pixels; row ++ ) { 
+		for (int c = 0;c < 1 ; c ++ ) { 
+ 	*(weighted.access(row, c)) = ({Matrix own( 1 ,24 ) ; 
+for (int r = 0;r < 1 ; r ++ ) { 
+		for (int t = 0;t < 24 ; t ++ ) { 
+ 	*(own.access(r, t)) = *(data.access(row, t)) 	;} } 
+Matrix product( Matrix::multiply  (own , weights ) ) ; 
+  *(product.access(0 , 0 )) ; })  	;} } 
+Matrix repeated( pixels,240 ) ; 
+auto repeated_kernel = [&] (int row, int t) -> float { return  (*(data.access(row,  (t -  ( (t / 24 )  * 24 ) ) ))  * 2 )  ; } ; 
+rowKernelRun(repeated, repeated_kernel) ; 
+int p ; 
+float total ; 
+total = 0  ; 
+int losses ; 
+losses = 0  ; 
+float diagonal ; 
+diagonal = 0  ; 
+for (p = 0 ; p <=  (pixels - 1 ) ; p ++ ){ 
+total =  ( ( (total + *(score.access(p, 0 )) )  + *(change.access(p, 1 )) )  + *(smooth.access(p, 0 )) )  ; 
+diagonal =  (diagonal + *(repeated.access(p,  (p -  ( (p / 240 )  * 240 ) ) )) )  ; 
+if ( (*(score.access(p, 0 ))  > 3 ) ) losses =  (losses + 1 )  ; 
+  } 
+fcalOut << total ; 
+fcalOut << " "  ; 
+fcalOut << losses ; 
+fcalOut << " "  ; 
+fcalOut << diagonal ; 
+fcalOut << "\n"  ; 
+for (p = 0 ; p <= 5 ; p ++ ){ 
+fcalOut << *(score.access(p, 0 ))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+for (p = 0 ; p <= 5 ; p ++ ){ 
+fcalOut << *(weighted.access(p, 0 ))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  
+}
+
@@ -0,0 +1,45 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 6 ,21 ) ; 
+for (int i = 0;i < 6 ; i ++ ) { 
+		for (int j = 0;j < 21 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( ( (i * 7 )  +  (j * 5 ) )  -  ( (j / 3 )  * 11 ) ) 	;} } 
+int i ; 
+int k ; 
+float s ; 
+float hi ; 
+float lo ; 
+for (i = 0 ; i <= 4 ; i ++ ){ 
+s = 0.0  ; 
+for (k = 0 ; k <=  (m.numCols() - 1 ) ; k ++ ){ 
+s =  ( (s + *(m.access(i, k)) )  - *(m.access( (i + 1 ) , k)) )  ; 
+  } 
+hi =  (0.0  - 1000.0 )  ; 
+for (k = i; k <= 20 ; k ++ ){ 
+hi = ( ( (hi < *(m.access(i, k)) ) ) ? (*(m.access(i, k)) ) : hi ) ; 
+  } 
+lo = 1000.0  ; 
+for (k = 0 ; k <=  (20  - i) ; k ++ ){ 
+lo = ( ( (*(m.access(i, k))  < lo) ) ? (*(m.access(i, k)) ) : lo ) ; 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << hi ; 
+fcalOut << " "  ; 
+fcalOut << lo ; 
+fcalOut << " "  ; 
+fcalOut << k ; 
+fcalOut << "\n"  ; 
+  } 
+s = 3.0  ; 
+for (k = 5 ; k <= 4 ; k ++ ){ 
+s =  (s + *(m.access(0 , k)) )  ; 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << k ; 
+fcalOut << "\n"  ; 
+  
+}
+
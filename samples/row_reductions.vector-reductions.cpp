@@ -0,0 +1,45 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 6 ,21 ) ; 
+for (int i = 0;i < 6 ; i ++ ) { 
+		for (int j = 0;j < 21 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( ( (i * 7 )  +  (j * 5 ) )  -  ( (j / 3 )  * 11 ) ) 	;} } 
+int i ; 
+int k ; 
+float s ; 
+float hi ; 
+float lo ; 
+for (i = 0 ; i <= 4 ; i ++ ){ 
+s = 0.0  ; 
+{ int b1_ = 0 , b2_ =  (m.numCols() - 1 )  ; 
+s = s + m.rowSum(i, b1_, b2_) - m.rowSum( (i + 1 ) , b1_, b2_) ; 
+k = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+hi =  (0.0  - 1000.0 )  ; 
+{ int b1_ = i, b2_ = 20  ; 
+hi = m.rowMax(i, b1_, b2_, hi) ; 
+k = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+lo = 1000.0  ; 
+{ int b1_ = 0 , b2_ =  (20  - i)  ; 
+lo = m.rowMin(i, b1_, b2_, lo) ; 
+k = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << hi ; 
+fcalOut << " "  ; 
+fcalOut << lo ; 
+fcalOut << " "  ; 
+fcalOut << k ; 
+fcalOut << "\n"  ; 
+  } 
+s = 3.0  ; 
+{ int b1_ = 5 , b2_ = 4  ; 
+s = s + m.rowSum(0 , b1_, b2_) ; 
+k = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+fcalOut << k ; 
+fcalOut << "\n"  ; 
+  
+}
+
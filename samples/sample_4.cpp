@@ -0,0 +1,14 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int x ; 
+x =  (2  + 4 )  ; 
+int y ; 
+y =  (x * 3 )  ; 
+fcalOut << x ; 
+fcalOut << "\n"  ; 
+fcalOut << y ; 
+fcalOut << "\n"  ; 
+  
+}
+
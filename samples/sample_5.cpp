@@ -0,0 +1,16 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int x ; 
+x = 0  ; 
+int y ; 
+for (y = 1 ; y <= 10 ; y ++ ){ 
+fcalOut << y ; 
+fcalOut << "\n"  ; 
+x =  (x + y)  ; 
+  } 
+fcalOut << x ; 
+fcalOut << "\n"  ; 
+  
+}
+
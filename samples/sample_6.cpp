@@ -0,0 +1,18 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int w ; 
+w = 4  ; 
+int h ; 
+h = 5  ; 
+int d ; 
+d = 6  ; 
+int volume ; 
+volume = ({int area ; 
+area =  (w * h)  ; 
+   (area * d) ; })   ; 
+fcalOut << volume ; 
+fcalOut << "\n"  ; 
+  
+}
+
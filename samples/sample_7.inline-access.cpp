@@ -0,0 +1,30 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 10 ,10 ) ; 
+for (int i = 0;i < 10 ; i ++ ) { 
+		for (int j = 0;j < 10 ; j ++ ) { 
+ 	m.at(i, j) =  (i * j) 	;} } 
+int i ; 
+int j ; 
+for (i = 0 ; i <= 9 ; i ++ ){ 
+for (j = 0 ; j <= 9 ; j ++ ){ 
+fcalOut << m.at(i, j)  ; 
+fcalOut << "  "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <= 9 ; i ++ ){ 
+for (j = 0 ; j <= 9 ; j ++ ){ 
+m.at(i, j) =  (m.at(i, j)  + 100 )  ;  } 
+  } 
+for (i = 0 ; i <= 9 ; i ++ ){ 
+for (j = 0 ; j <= 9 ; j ++ ){ 
+fcalOut << m.at(i, j)  ; 
+fcalOut << "  "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+  
+}
+
@@ -0,0 +1,50 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int years ; 
+years = 40  ; 
+Matrix yearly( years,1 ) ; 
+for (int i = 0;i < years; i ++ ) { 
+		for (int j = 0;j < 1 ; j ++ ) { 
+ 	*(yearly.access(i, j)) =  ( (i * 3 )  -  ( (i / 4 )  * 10 ) ) 	;} } 
+SparseMatrix band = SparseMatrix::build(years, years, [&] (int i, int j) -> bool { return  ( ( (i - j)  *  (i - j) )  <= 4 )  ; }, [&] (int i, int j) -> float { return  (*(yearly.access(i, 0 ))  - *(yearly.access(j, 0 )) )  ; }) ; 
+fcalOut << band.nnz() ; 
+fcalOut << " "  ; 
+fcalOut <<  (band.numRows() * band.numCols())  ; 
+fcalOut << "\n"  ; 
+fcalOut << SparseMatrix::fold (band , Matrix::FoldSum)  ; 
+fcalOut << " "  ; 
+fcalOut << SparseMatrix::fold (band , Matrix::FoldMax)  ; 
+fcalOut << " "  ; 
+fcalOut << SparseMatrix::fold (band , Matrix::FoldMin)  ; 
+fcalOut << "\n"  ; 
+int r ; 
+int c ; 
+float v ; 
+float gains ; 
+int losses ; 
+gains = 0  ; 
+losses = 0  ; 
+for (r = 0; r < band.numRows(); r ++ ) 
+for (int nz_ = band.rowBegin(r); nz_ < band.rowEnd(r); nz_ ++ ) { 
+c = band.column(nz_) ; 
+v = band.value(nz_) ; 
+{ 
+if ( (v > 0 ) ) gains =  (gains + v)  ; 
+if ( ( (v < 0 )  &&  (c < r) ) ) losses =  (losses + 1 )  ; 
+  } 
+
+} 
+fcalOut << gains ; 
+fcalOut << " "  ; 
+fcalOut << losses ; 
+fcalOut << "\n"  ; 
+fcalOut <<  (*(band.access(5 , 4 ))  + *(band.access(5 , 30 )) )  ; 
+fcalOut << "\n"  ; 
+SparseMatrix corner = SparseMatrix::build(4 , 5 , [&] (int i, int j) -> bool { return ! ( (i > j) ) ; }, [&] (int i, int j) -> float { return  (i + j)  ; }) ; 
+fcalOut << corner ; 
+fcalOut << SparseMatrix::foldRows (corner , Matrix::FoldSum)  ; 
+fcalOut << SparseMatrix::foldCols (corner , Matrix::FoldMax)  ; 
+  
+}
+
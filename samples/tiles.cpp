@@ -0,0 +1,39 @@
+#include "fcalrt.h"
+using namespace std; 
+static void fcalProgram (string tile) { 
+Matrix scene( Matrix::readMatrix  (tile ) ) ; 
+int rows ; 
+rows = scene.numRows() ; 
+int cols ; 
+cols = scene.numCols() ; 
+Matrix change( rows, (cols - 1 ) ) ; 
+for (int i = 0;i < rows; i ++ ) { 
+		for (int j = 0;j <  (cols - 1 ) ; j ++ ) { 
+ 	*(change.access(i, j)) =  (*(scene.access(i,  (j + 1 ) ))  - *(scene.access(i, j)) ) 	;} } 
+float total ; 
+total = 0  ; 
+int losses ; 
+losses = 0  ; 
+int i ; 
+int j ; 
+for (i = 0 ; i <=  (rows - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (cols - 2 ) ; j ++ ){ 
+total =  (total + *(scene.access(i, j)) )  ; 
+if ( (*(change.access(i, j))  <  (0  - 2 ) ) ) losses =  (losses + 1 )  ; 
+  } 
+total =  (total + *(scene.access(i,  (cols - 1 ) )) )  ; 
+  } 
+fcalOut << rows ; 
+fcalOut << " x "  ; 
+fcalOut << cols ; 
+fcalOut << ": mean "  ; 
+fcalOut <<  (total /  (rows * cols) )  ; 
+fcalOut << ", losses "  ; 
+fcalOut << losses ; 
+fcalOut << "\n"  ; 
+  
+}
+int main (int argc, char **argv) { 
+return runTiles(argc, argv, fcalProgram) ; 
+}
+
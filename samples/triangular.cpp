@@ -0,0 +1,72 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int n ; 
+n = 5  ; 
+Matrix up( n,n) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = 0;j < n; j ++ ) { 
+ 	*(up.access(i, j)) = ( ( (j <= i) ) ? (0.0 ) :  ( (i * 10 )  + j)  )	;} } 
+Matrix low( n, (n + 2 ) ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = 0;j <  (n + 2 ) ; j ++ ) { 
+ 	*(low.access(i, j)) = ( ( (i >= j) ) ? ( (i +  (j * 0.5 ) ) ) :  (0.0  - 1 )  )	;} } 
+Matrix sym( n,n) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = 0;j < n; j ++ ) { 
+ 	*(sym.access(i, j)) = ( ( (j < i) ) ? (*(sym.access(j, i)) ) :  ( (i * n)  + j)  )	;} } 
+int i ; 
+int j ; 
+float s ; 
+for (i = 0 ; i <=  (up.numRows() - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (up.numCols() - 1 ) ; j ++ ){ 
+fcalOut << *(up.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <=  (low.numRows() - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (low.numCols() - 1 ) ; j ++ ){ 
+fcalOut << *(low.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (n - 1 ) ; j ++ ){ 
+fcalOut << *(sym.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+s = 0.0  ; 
+for (i = 1 ; i <= 3 ; i ++ ){ 
+for (j = 0 ; j <= 4 ; j ++ ){ 
+s =  (s + *(up.access(i, j)) )  ; 
+  } 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+s = 0.0  ; 
+for (j = 0 ; j <=  (n - 1 ) ; j ++ ){ 
+s =  ( (s + *(sym.access(i, j)) )  - *(low.access(i, j)) )  ; 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+s = 100.0  ; 
+for (j = 0 ; j <=  (n + 1 ) ; j ++ ){ 
+s = ( ( (*(low.access(i, j))  < s) ) ? (*(low.access(i, j)) ) : s ) ; 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+s = 0.0  ; 
+for (j = 1 ; j <=  (n - 1 ) ; j ++ ){ 
+s = ( ( (s < *(sym.access(i, j)) ) ) ? (*(sym.access(i, j)) ) : s ) ; 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  } 
+  
+}
+
@@ -0,0 +1,71 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int n ; 
+n = 5  ; 
+TriangularMatrix up( n,n, TriangularMatrix::Upper, 1, 0.0 ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = up.firstCol(i);j <= up.lastCol(i); j ++ ) { 
+ 	*(up.access(i, j)) =  ( (i * 10 )  + j) 	;} } 
+TriangularMatrix low( n, (n + 2 ) , TriangularMatrix::Lower, 0,  (0.0  - 1 ) ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = low.firstCol(i);j <= low.lastCol(i); j ++ ) { 
+ 	*(low.access(i, j)) =  (i +  (j * 0.5 ) ) 	;} } 
+TriangularMatrix sym( n,n, TriangularMatrix::Upper, 0, 0, true) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = sym.firstCol(i);j <= sym.lastCol(i); j ++ ) { 
+ 	*(sym.access(i, j)) =  ( (i * n)  + j) 	;} } 
+int i ; 
+int j ; 
+float s ; 
+for (i = 0 ; i <=  (up.numRows() - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (up.numCols() - 1 ) ; j ++ ){ 
+fcalOut << *(up.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <=  (low.numRows() - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (low.numCols() - 1 ) ; j ++ ){ 
+fcalOut << *(low.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (n - 1 ) ; j ++ ){ 
+fcalOut << *(sym.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+s = 0.0  ; 
+{ int b1_ = 1 , b2_ = 3 , b3_ = 0 , b4_ = 4  ; 
+s = s + up.prefixSums().rect(b1_, b2_, b3_, b4_) ; 
+if (b1_ <= b2_) j = (b3_ <= b4_) ? b4_ + 1 : b3_ ; 
+i = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+s = 0.0  ; 
+{ int b1_ = 0 , b2_ =  (n - 1 )  ; 
+s = s + sym.rowSum(i, b1_, b2_) - low.rowSum(i, b1_, b2_) ; 
+j = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+s = 100.0  ; 
+{ int b1_ = 0 , b2_ =  (n + 1 )  ; 
+s = low.rowMin(i, b1_, b2_, s) ; 
+j = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+s = 0.0  ; 
+{ int b1_ = 1 , b2_ =  (n - 1 )  ; 
+s = sym.rowMax(i, b1_, b2_, s) ; 
+j = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  } 
+  
+}
+
@@ -0,0 +1,72 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int n ; 
+n = 5  ; 
+TriangularMatrix up( n,n, TriangularMatrix::Upper, 1, 0.0 ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = up.firstCol(i);j <= up.lastCol(i); j ++ ) { 
+ 	*(up.access(i, j)) =  ( (i * 10 )  + j) 	;} } 
+TriangularMatrix low( n, (n + 2 ) , TriangularMatrix::Lower, 0,  (0.0  - 1 ) ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = low.firstCol(i);j <= low.lastCol(i); j ++ ) { 
+ 	*(low.access(i, j)) =  (i +  (j * 0.5 ) ) 	;} } 
+TriangularMatrix sym( n,n, TriangularMatrix::Upper, 0, 0, true) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = sym.firstCol(i);j <= sym.lastCol(i); j ++ ) { 
+ 	*(sym.access(i, j)) =  ( (i * n)  + j) 	;} } 
+int i ; 
+int j ; 
+float s ; 
+for (i = 0 ; i <=  (up.numRows() - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (up.numCols() - 1 ) ; j ++ ){ 
+fcalOut << *(up.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <=  (low.numRows() - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (low.numCols() - 1 ) ; j ++ ){ 
+fcalOut << *(low.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+for (j = 0 ; j <=  (n - 1 ) ; j ++ ){ 
+fcalOut << *(sym.access(i, j))  ; 
+fcalOut << " "  ; 
+  } 
+fcalOut << "\n"  ; 
+  } 
+s = 0.0  ; 
+for (i = 1 ; i <= 3 ; i ++ ){ 
+for (j = 0 ; j <= 4 ; j ++ ){ 
+s =  (s + *(up.access(i, j)) )  ; 
+  } 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+s = 0.0  ; 
+for (j = 0 ; j <=  (n - 1 ) ; j ++ ){ 
+s =  ( (s + *(sym.access(i, j)) )  - *(low.access(i, j)) )  ; 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+s = 100.0  ; 
+for (j = 0 ; j <=  (n + 1 ) ; j ++ ){ 
+s = ( ( (*(low.access(i, j))  < s) ) ? (*(low.access(i, j)) ) : s ) ; 
+  } 
+fcalOut << s ; 
+fcalOut << " "  ; 
+s = 0.0  ; 
+for (j = 1 ; j <=  (n - 1 ) ; j ++ ){ 
+s = ( ( (s < *(sym.access(i, j)) ) ) ? (*(sym.access(i, j)) ) : s ) ; 
+  } 
+fcalOut << s ; 
+fcalOut << "\n"  ; 
+  } 
+  
+}
+
@@ -0,0 +1,60 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+int n ; 
+n = 6  ; 
+Matrix data( n,8 ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = 0;j < 8 ; j ++ ) { 
+ 	*(data.access(i, j)) =  ( ( (i * 8 )  + j)  * 0.37 ) 	;} } 
+TypedMatrix<uint8_t> label( n,8 ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = 0;j < 8 ; j ++ ) { 
+ 	*(label.access(i, j)) = ( ( (*(data.access(i, j))  > 12 ) ) ? (2 ) : ( ( (*(data.access(i, j))  > 5 ) ) ? (1 ) : 0  ) )	;} } 
+TypedMatrix<int32_t> counts( 3 ,1 ) ; 
+for (int c = 0;c < 3 ; c ++ ) { 
+		for (int k = 0;k < 1 ; k ++ ) { 
+ 	*(counts.access(c, k)) = 0 	;} } 
+int i ; 
+int j ; 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+for (j = 0 ; j <= 7 ; j ++ ){ 
+*(counts.access(*(label.access(i, j)) , 0 )) =  (*(counts.access(*(label.access(i, j)) , 0 ))  + 1 )  ;  } 
+  } 
+fcalOut << label ; 
+fcalOut << counts ; 
+fcalOut <<  (*(counts.access(1 , 0 ))  / 2 )  ; 
+fcalOut << "\n"  ; 
+TypedMatrix<double> total( 1 ,1 ) ; 
+for (int r = 0;r < 1 ; r ++ ) { 
+		for (int c = 0;c < 1 ; c ++ ) { 
+ 	*(total.access(r, c)) = 0 	;} } 
+float single ; 
+single = 0  ; 
+for (i = 1 ; i <= 200000 ; i ++ ){ 
+*(total.access(0 , 0 )) =  (*(total.access(0 , 0 ))  + 0.1 )  ;single =  (single + 0.1 )  ; 
+  } 
+fcalOut <<  ( ( (*(total.access(0 , 0 ))  - 20000 )  < 0.001 )  &&  ( (20000  - *(total.access(0 , 0 )) )  < 0.001 ) )  ; 
+fcalOut << " "  ; 
+fcalOut <<  ( ( (single - 20000 )  < 0.001 )  &&  ( (20000  - single)  < 0.001 ) )  ; 
+fcalOut << "\n"  ; 
+Matrix flags( n,8 ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = 0;j < 8 ; j ++ ) { 
+ 	*(flags.access(i, j)) =  (*(data.access(i, j))  > 7 ) 	;} } 
+Matrix place( n,8 ) ; 
+for (int i = 0;i < n; i ++ ) { 
+		for (int j = 0;j < 8 ; j ++ ) { 
+ 	*(place.access(i, j)) =  ( (i * 8 )  + j) 	;} } 
+float sum ; 
+sum = 0  ; 
+for (i = 0 ; i <=  (n - 1 ) ; i ++ ){ 
+for (j = 0 ; j <= 7 ; j ++ ){ 
+sum =  ( (sum +  (*(flags.access(i, j))  / 2 ) )  +  (*(place.access(i, j))  / 4 ) )  ; 
+  } 
+  } 
+fcalOut << sum ; 
+fcalOut << "\n"  ; 
+  
+}
+
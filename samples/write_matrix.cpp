@@ -0,0 +1,28 @@
+#include "fcalrt.h"
+using namespace std; 
+int main () { 
+Matrix m( 3 ,4 ) ; 
+for (int i = 0;i < 3 ; i ++ ) { 
+		for (int j = 0;j < 4 ; j ++ ) { 
+ 	*(m.access(i, j)) =  ( (i + 1 )  /  (j + 7.0 ) ) 	;} } 
+Matrix::writeMatrix  (m , "../samples/write_matrix.fcm"  ) ; 
+Matrix back( Matrix::readMatrix  ("../samples/write_matrix.fcm"  ) ) ; 
+fcalOut << back ; 
+fcalOut <<  (back.numRows() * back.numCols())  ; 
+fcalOut << " cells, "  ; 
+int same ; 
+int i ; 
+int j ; 
+same = 0  ; 
+for (i = 0 ; i <= 2 ; i ++ ){ 
+for (j = 0 ; j <= 3 ; j ++ ){ 
+if ( (*(back.access(i, j))  == *(m.access(i, j)) ) ) { 
+same =  (same + 1 )  ; 
+  } 
+  } 
+  } 
+fcalOut << same ; 
+fcalOut << " equal\n"  ; 
+  
+}
+
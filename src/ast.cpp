@@ -6,23 +6,981 @@
 */
 #include "ast.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+
 using namespace std ;
 
+CodeGenOptions Node::options ;
+ProgramFacts Node::facts ;
+
+string CodeGenOptions::signature () {
+	string s ;
+	if (inlineAccess) s += " --inline-access" ;
+	if (boundsCheck) s += " --bounds-check" ;
+	if (prefixSums) s += " --prefix-sums" ;
+	if (vectorReductions) s += " --vector-reductions" ;
+	if (triangular) s += " --triangular" ;
+	if (views) s += " --views" ;
+	if (fixedSize) s += " --fixed-size" ;
+	if (blockedMatmul) s += " --blocked-matmul" ;
+	if (narrowTypes) s += " --narrow-types" ;
+	if (quantize) s += " --quantize" ;
+	if (rowKernels) s += " --row-kernels" ;
+	return s ;
+}
+
+//ProgramFacts and helpers for the analyses
+//----------------------------------------------
+
+static bool foldInt ( Expr *e, long &value, int depth = 0 ) ;
+static bool byteCells ( Expr *e ) ;
+
+//children, for the analyses walking the tree
+//----------------------------------------------
+
+void Root::children ( vector<Node *> &kids ) {
+	kids.push_back(varName) ;
+	if (param) kids.push_back(param) ;
+	kids.push_back(stmts) ;
+}
+
+void DeclStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(decl) ;
+}
+
+void IfStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(ifExpr) ;
+	kids.push_back(thenStmt) ;
+}
+
+void IfElseStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(ifExpr) ;
+	kids.push_back(thenStmt) ;
+	kids.push_back(elseStmt) ;
+}
+
+void BlockStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(statements) ;
+}
+
+void PrintStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(printExpr) ;
+}
+
+void CallStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(call) ;
+}
+
+void AssignStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	kids.push_back(rightExpr) ;
+}
+
+void LongAssignStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	kids.push_back(leftExpr1) ;
+	kids.push_back(leftExpr2) ;
+	if (leftExpr3) kids.push_back(leftExpr3) ;
+	kids.push_back(rightExpr) ;
+}
+
+void WhileStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(whileExpr) ;
+	kids.push_back(whileStmt) ;
+}
+
+void ForStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	kids.push_back(expr1) ;
+	kids.push_back(expr2) ;
+	kids.push_back(statements) ;
+}
+
+void SparseForStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(row) ;
+	kids.push_back(col) ;
+	kids.push_back(value) ;
+	kids.push_back(source) ;
+	kids.push_back(statements) ;
+}
+
+void ParforStmt::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	kids.push_back(expr1) ;
+	kids.push_back(expr2) ;
+	kids.insert(kids.end(), reduced.begin(), reduced.end()) ;
+	kids.push_back(statements) ;
+}
+
+void StmtsSeq::children ( vector<Node *> &kids ) {
+	kids.push_back(stmt) ;
+	kids.push_back(stmts) ;
+}
+
+void SimpleDecl::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+}
+
+void MatrixDecl::children ( vector<Node *> &kids ) {
+	kids.push_back(var1) ;
+	kids.push_back(expr1) ;
+}
+
+void LongMatrixDecl::children ( vector<Node *> &kids ) {
+	kids.push_back(var1) ;
+	kids.push_back(var2) ;
+	kids.push_back(var3) ;
+	kids.push_back(expr1) ;
+	kids.push_back(expr2) ;
+	kids.push_back(expr3) ;
+}
+
+void MaskDecl::children ( vector<Node *> &kids ) {
+	kids.push_back(var1) ;
+	kids.push_back(expr1) ;
+}
+
+void LongMaskDecl::children ( vector<Node *> &kids ) {
+	kids.push_back(var1) ;
+	kids.push_back(var2) ;
+	kids.push_back(var3) ;
+	kids.push_back(expr1) ;
+	kids.push_back(expr2) ;
+	kids.push_back(expr3) ;
+}
+
+void LongSparseDecl::children ( vector<Node *> &kids ) {
+	kids.push_back(var1) ;
+	kids.push_back(var2) ;
+	kids.push_back(var3) ;
+	kids.push_back(expr1) ;
+	kids.push_back(expr2) ;
+	kids.push_back(expr3) ;
+}
+
+void BinOpExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(left) ;
+	kids.push_back(right) ;
+}
+
+void NestOrFuncExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	kids.push_back(expr) ;
+	kids.push_back(expr2) ;
+}
+
+void ParenExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(expr) ;
+}
+
+void MatrixRefExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	kids.push_back(expr1) ;
+	kids.push_back(expr2) ;
+	if (expr3) kids.push_back(expr3) ;
+}
+
+void LongCubeDecl::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	for (int axis = 0; axis < 3; axis ++) kids.push_back(indices[axis]) ;
+	for (int axis = 0; axis < 3; axis ++) kids.push_back(extents[axis]) ;
+	kids.push_back(cell) ;
+}
+
+void CubeDecl::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	for (int axis = 0; axis < 3; axis ++) kids.push_back(extents[axis]) ;
+	kids.push_back(source) ;
+}
+
+void LetExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(stmts) ;
+	kids.push_back(expr) ;
+}
+
+void IfElseExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(expr1) ;
+	kids.push_back(expr2) ;
+	kids.push_back(expr3) ;
+}
+
+void NotExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(expr) ;
+}
+
+void MapExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	kids.push_back(source) ;
+	kids.push_back(body) ;
+}
+
+void ZipExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(var1) ;
+	kids.push_back(source1) ;
+	kids.push_back(var2) ;
+	kids.push_back(source2) ;
+	kids.push_back(body) ;
+}
+
+void FilterExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(var) ;
+	kids.push_back(source) ;
+	kids.push_back(cond) ;
+}
+
+void FoldExpr::children ( vector<Node *> &kids ) {
+	kids.push_back(source) ;
+}
+
+/*! \fn void ProgramFacts::collect(Node *root)
+    \brief Records the declarations of, assignments to and uses of every
+    variable of the program
+*/
+void ProgramFacts::collect ( Node *root ) {
+	written.clear() ;
+	types.clear() ;
+	wholeUses.clear() ;
+	declarations.clear() ;
+	assignments.clear() ;
+	specialized.clear() ;
+	narrowed.clear() ;
+	errors.clear() ;
+	cells.clear() ;
+	summed.clear() ;
+	set<Node *> named ; // VarNames that declare, or are indexed or measured
+	vector<Node *> work ;
+	work.push_back(root) ;
+	while (!work.empty()) {
+		Node *n = work.back() ;
+		work.pop_back() ;
+		if (n == NULL) continue ;
+		if (MatrixRefExpr *r = dynamic_cast<MatrixRefExpr *>(n))
+			named.insert(r->matrix()) ;
+		if (NestOrFuncExpr *f = dynamic_cast<NestOrFuncExpr *>(n)) {
+			string fn = f->function()->name() ;
+			named.insert(f->function()) ;
+			if (fn == "numRows" || fn == "numCols") named.insert(f->argument()) ;
+		}
+		if (VarName *v = dynamic_cast<VarName *>(n))
+			if (named.count(v) == 0) wholeUses.insert(v->name()) ;
+		if (LongAssignStmt *la = dynamic_cast<LongAssignStmt *>(n))
+			written.insert(la->matrix()->name()) ;
+		if (AssignStmt *a = dynamic_cast<AssignStmt *>(n)) {
+			written.insert(a->target()->name()) ;
+			assignments[a->target()->name()].push_back(a->value()) ;
+		}
+		if (ForStmt *f = dynamic_cast<ForStmt *>(n))
+			assignments[f->variable()->name()].push_back(NULL) ;
+		if (SparseForStmt *f = dynamic_cast<SparseForStmt *>(n)) {
+			assignments[f->rowVariable()->name()].push_back(NULL) ;
+			assignments[f->colVariable()->name()].push_back(NULL) ;
+			assignments[f->valueVariable()->name()].push_back(NULL) ;
+		}
+		if (ParforStmt *f = dynamic_cast<ParforStmt *>(n)) {
+			assignments[f->variable()->name()].push_back(NULL) ;
+			for (size_t i = 0; i < f->reductions().size(); i ++) {
+				written.insert(f->reductions()[i]->name()) ;
+				assignments[f->reductions()[i]->name()].push_back(NULL) ;
+			}
+		}
+		if (SimpleDecl *d = dynamic_cast<SimpleDecl *>(n)) {
+			declare(d->variable()->name(), d->keyword()) ;
+			named.insert(d->variable()) ;
+		}
+		if (Root *r = dynamic_cast<Root *>(n))
+			if (r->parameter() != NULL) {
+				declare(r->parameter()->name(), "Str") ;
+				named.insert(r->parameter()) ;
+			}
+		if (MatrixDecl *d = dynamic_cast<MatrixDecl *>(n)) {
+			declare(d->variable()->name(), "Matrix") ;
+			named.insert(d->variable()) ;
+		}
+		if (LongMatrixDecl *d = dynamic_cast<LongMatrixDecl *>(n)) {
+			string element = d->elementType() ;
+			declare(d->variable()->name(), element == "Float" ? "Matrix" : "Matrix<" + element + ">") ;
+			named.insert(d->variable()) ;
+			// The index variables are declared, and shadow, in the comprehension.
+			declare(d->rowVariable()->name(), "Int") ;
+			declare(d->colVariable()->name(), "Int") ;
+			named.insert(d->rowVariable()) ;
+			named.insert(d->colVariable()) ;
+		}
+		if (MaskDecl *d = dynamic_cast<MaskDecl *>(n)) {
+			declare(d->variable()->name(), "Mask") ;
+			named.insert(d->variable()) ;
+		}
+		if (LongMaskDecl *d = dynamic_cast<LongMaskDecl *>(n)) {
+			declare(d->variable()->name(), "Mask") ;
+			named.insert(d->variable()) ;
+			declare(d->rowVariable()->name(), "Int") ;
+			declare(d->colVariable()->name(), "Int") ;
+			named.insert(d->rowVariable()) ;
+			named.insert(d->colVariable()) ;
+		}
+		if (LongSparseDecl *d = dynamic_cast<LongSparseDecl *>(n)) {
+			declare(d->variable()->name(), "Sparse") ;
+			named.insert(d->variable()) ;
+			declare(d->rowVariable()->name(), "Int") ;
+			declare(d->colVariable()->name(), "Int") ;
+			named.insert(d->rowVariable()) ;
+			named.insert(d->colVariable()) ;
+		}
+		if (CubeDecl *d = dynamic_cast<CubeDecl *>(n)) {
+			declare(d->variable()->name(), "Cube") ;
+			named.insert(d->variable()) ;
+		}
+		if (LongCubeDecl *d = dynamic_cast<LongCubeDecl *>(n)) {
+			declare(d->variable()->name(), "Cube") ;
+			named.insert(d->variable()) ;
+			for (int axis = 0; axis < 3; axis ++) {
+				declare(d->index(axis)->name(), "Int") ;
+				named.insert(d->index(axis)) ;
+			}
+		}
+		// The cell variables of map, zip and filter are only declared in
+		// their body; see cells.
+		if (MapExpr *m = dynamic_cast<MapExpr *>(n))
+			named.insert(m->cell()) ;
+		if (ZipExpr *z = dynamic_cast<ZipExpr *>(n)) {
+			named.insert(z->firstCell()) ;
+			named.insert(z->secondCell()) ;
+		}
+		if (FilterExpr *f = dynamic_cast<FilterExpr *>(n))
+			named.insert(f->cell()) ;
+		n->children(work) ;
+	}
+	valid = true ;
+	check(root) ;
+}
+
+bool ProgramFacts::readOnly ( const string &name ) {
+	return valid && written.count(name) == 0 ;
+}
+
+void ProgramFacts::declare ( const string &name, const string &type ) {
+	declarations[name] ++ ;
+	map<string, string>::iterator t = types.find(name) ;
+	if (t == types.end()) types[name] = type ;
+	else if (t->second != type) t->second = "?" ;
+}
+
+bool ProgramFacts::onlyIndexed ( const string &name ) {
+	return readOnly(name) && !usedWhole(name) ;
+}
+
+bool ProgramFacts::usedWhole ( const string &name ) {
+	return !valid || wholeUses.count(name) > 0 ;
+}
+
+Expr *ProgramFacts::singleAssignment ( const string &name ) {
+	if (!valid || declarations[name] != 1 || bindsCell(name)) return NULL ;
+	vector<Expr *> &values = assignments[name] ;
+	return values.size() == 1 ? values[0] : NULL ;
+}
+
+string ProgramFacts::typeOf ( const string &name ) {
+	if (!valid) return "" ;
+	if (bindsCell(name)) return "Float" ;
+	map<string, string>::iterator t = types.find(name) ;
+	return t == types.end() || t->second == "?" ? "" : t->second ;
+}
+
+string ProgramFacts::exprType ( Expr *e ) {
+	if (AnyConst *c = dynamic_cast<AnyConst *>(e)) {
+		string text = c->text() ;
+		if (text.find('"') != string::npos) return "Str" ;
+		if (text == "True" || text == "False") return "Bool" ;
+		return text.find('.') != string::npos ? "Float" : "Int" ;
+	}
+	if (VarName *v = dynamic_cast<VarName *>(e)) return typeOf(v->name()) ;
+	if (MatrixRefExpr *r = dynamic_cast<MatrixRefExpr *>(e)) {
+		string t = typeOf(r->matrix()->name()) ;
+		if (t == "Mask") return "Bool" ;
+		return t == "Matrix<Int>" || t == "Matrix<Byte>" ? "Int" : "Float" ;
+	}
+	if (ParenExpr *p = dynamic_cast<ParenExpr *>(e)) return exprType(p->inner()) ;
+	if (NestOrFuncExpr *f = dynamic_cast<NestOrFuncExpr *>(e)) {
+		string fn = f->function()->name() ;
+		if (fn == "matmul" || fn == "readMatrix") return "Matrix" ;
+		if (fn == "numRows" || fn == "numCols" || fn == "count" || fn == "extent"
+		    || fn == "nnz") return "Int" ;
+		return "" ;
+	}
+	if (dynamic_cast<MapExpr *>(e) || dynamic_cast<ZipExpr *>(e)
+	    || dynamic_cast<FilterExpr *>(e))
+		return "Matrix" ;
+	if (FoldExpr *f = dynamic_cast<FoldExpr *>(e))
+		return f->along() == "" ? "Float" : "Matrix" ;
+	if (IfElseExpr *i = dynamic_cast<IfElseExpr *>(e)) {
+		string t = exprType(i->thenExpr()) ;
+		return t == exprType(i->elseExpr()) ? t : "" ;
+	}
+	if (NotExpr *n = dynamic_cast<NotExpr *>(e))
+		return exprType(n->operand()) == "Mask" ? "Mask" : "Bool" ;
+	BinOpExpr *b = dynamic_cast<BinOpExpr *>(e) ;
+	if (b == NULL) return "" ;
+	string op = b->opName() ;
+	string l = exprType(b->leftOperand()), r = exprType(b->rightOperand()) ;
+	if (l == "Mask" || r == "Mask") return l == r && (op == "&&" || op == "||") ? "Mask" : "" ;
+	if (op == "&&" || op == "||") return "Bool" ;
+	// element-wise, see ElementWise in Matrix.h; comparisons give 0/1 matrices
+	if (l == "Matrix" || r == "Matrix") return "Matrix" ;
+	if (op != "+" && op != "-" && op != "*" && op != "/") return "Bool" ;
+	if (l == "Int" && r == "Int") return "Int" ;
+	if ((l == "Int" || l == "Float") && (r == "Int" || r == "Float")) return "Float" ;
+	return "" ;
+}
+
+/*! \fn void ProgramFacts::checkCollection(Node *n)
+    \brief Records an error if n is a map, zip, filter or fold over
+    something other than a matrix, or a fold over a Sparse matrix,
+    or whose body is not a number
+*/
+void ProgramFacts::checkCollection ( Node *n ) {
+	string name, body ;
+	vector<Expr *> sources ;
+	int line = 0 ;
+	if (MapExpr *m = dynamic_cast<MapExpr *>(n)) {
+		name = "map" ; line = m->sourceLine() ;
+		sources.push_back(m->matrix()) ;
+		body = exprType(m->value()) ;
+	}
+	else if (ZipExpr *z = dynamic_cast<ZipExpr *>(n)) {
+		name = "zip" ; line = z->sourceLine() ;
+		sources.push_back(z->firstMatrix()) ;
+		sources.push_back(z->secondMatrix()) ;
+		body = exprType(z->value()) ;
+	}
+	else if (FilterExpr *f = dynamic_cast<FilterExpr *>(n)) {
+		name = "filter" ; line = f->sourceLine() ;
+		sources.push_back(f->matrix()) ;
+		body = exprType(f->condition()) ;
+	}
+	else if (FoldExpr *f = dynamic_cast<FoldExpr *>(n)) {
+		name = "fold" ; line = f->sourceLine() ;
+		sources.push_back(f->matrix()) ;
+	}
+	else return ;
+	char where[32] ;
+	snprintf (where, sizeof(where), "line %d: ", line) ;
+	for (size_t i = 0; i < sources.size(); i ++) {
+		string t = exprType(sources[i]) ;
+		if (t != "" && t != "Matrix" && (name != "fold" || t != "Sparse"))
+			errors.push_back(where + name + " needs a Matrix, not " + t) ;
+	}
+	if (body == "Matrix" || body == "Str")
+		errors.push_back(where + name + " needs a number for each cell, not " + body) ;
+}
+
+/*! \fn void ProgramFacts::checkParfor(Node *n)
+    \brief Records an error if n is a parfor reducing something other than
+    a number, whose iterations would all assign one matrix, assign cells
+    of a shared Mask, whose neighbouring cells share a word, or print or
+    call a statement such as writeMatrix, which would interleave their
+    output in any order
+*/
+void ProgramFacts::checkParfor ( Node *n ) {
+	ParforStmt *p = dynamic_cast<ParforStmt *>(n) ;
+	if (p == NULL) return ;
+	char where[32] ;
+	snprintf (where, sizeof(where), "line %d: ", p->sourceLine()) ;
+	for (size_t i = 0; i < p->reductions().size(); i ++) {
+		string t = typeOf(p->reductions()[i]->name()) ;
+		if (t != "Int" && t != "Float")
+			errors.push_back(where + (string) "parfor reduces Int and Float variables, not "
+			                 + (t == "" ? p->reductions()[i]->name() : t)) ;
+	}
+	set<string> assigned = p->assigned() ;
+	for (set<string>::iterator i = assigned.begin(); i != assigned.end(); i ++)
+		if (typeOf(*i) == "Matrix" || typeOf(*i) == "Mask")
+			errors.push_back(where + (string) "parfor iterations cannot all assign the "
+			                 + typeOf(*i) + " " + *i) ;
+	set<string> masks, local ;
+	vector<Node *> work ;
+	work.push_back(p->body()) ;
+	while (!work.empty()) {
+		Node *m = work.back() ;
+		work.pop_back() ;
+		if (m == NULL) continue ;
+		if (MaskDecl *d = dynamic_cast<MaskDecl *>(m)) local.insert(d->variable()->name()) ;
+		if (LongMaskDecl *d = dynamic_cast<LongMaskDecl *>(m)) local.insert(d->variable()->name()) ;
+		if (LongAssignStmt *a = dynamic_cast<LongAssignStmt *>(m))
+			if (typeOf(a->matrix()->name()) == "Mask") masks.insert(a->matrix()->name()) ;
+		if (dynamic_cast<PrintStmt *>(m))
+			errors.push_back(where + (string) "parfor iterations cannot print") ;
+		if (CallStmt *c = dynamic_cast<CallStmt *>(m))
+			errors.push_back(where + (string) "parfor iterations cannot call "
+			                 + c->callee()->function()->name()) ;
+		vector<Node *> kids ;
+		m->children(kids) ;
+		work.insert(work.end(), kids.rbegin(), kids.rend()) ; // in source order
+	}
+	for (set<string>::iterator i = masks.begin(); i != masks.end(); i ++)
+		if (local.count(*i) == 0)
+			errors.push_back(where + (string) "parfor iterations cannot assign cells of the Mask " + *i) ;
+}
+
+/*! \fn void ProgramFacts::checkIndices(Node *n)
+    \brief Records an error if n indexes a Cube with other than three
+    indices, or anything else with three
+*/
+void ProgramFacts::checkIndices ( Node *n ) {
+	string name ;
+	bool depth ;
+	int line ;
+	if (MatrixRefExpr *r = dynamic_cast<MatrixRefExpr *>(n)) {
+		name = r->matrix()->name() ; depth = r->depthIndex() != NULL ; line = r->sourceLine() ;
+	}
+	else if (LongAssignStmt *a = dynamic_cast<LongAssignStmt *>(n)) {
+		name = a->matrix()->name() ; depth = a->depthIndex() != NULL ; line = a->sourceLine() ;
+	}
+	else return ;
+	string t = typeOf(name) ;
+	if (t == "" || (t == "Cube") == depth) return ;
+	char where[32] ;
+	snprintf (where, sizeof(where), "line %d: ", line) ;
+	errors.push_back(where + t + " " + name + " takes " + (t == "Cube" ? "3" : "2") + " indices") ;
+}
+
+/*! \fn void ProgramFacts::checkCube(Node *n)
+    \brief Records an error if n reads something other than a Matrix as a
+    Cube, or takes the extent of an axis that folds to a constant other
+    than 0, 1 or 2
+*/
+void ProgramFacts::checkCube ( Node *n ) {
+	char where[32] ;
+	if (CubeDecl *d = dynamic_cast<CubeDecl *>(n)) {
+		string t = exprType(d->matrix()) ;
+		if (t == "" || t == "Matrix") return ;
+		snprintf (where, sizeof(where), "line %d: ", d->sourceLine()) ;
+		errors.push_back(where + (string) "Cube " + d->variable()->name()
+		                 + " reads the rows of a Matrix, not a " + t) ;
+		return ;
+	}
+	NestOrFuncExpr *f = dynamic_cast<NestOrFuncExpr *>(n) ;
+	long axis ;
+	if (f == NULL || f->function()->name() != "extent" || f->secondArgument() == NULL
+	    || !foldInt(f->secondArgument(), axis) || (axis >= 0 && axis <= 2))
+		return ;
+	snprintf (where, sizeof(where), "line %d: ", f->sourceLine()) ;
+	char given[32] ;
+	snprintf (given, sizeof(given), "%ld", axis) ;
+	errors.push_back(where + (string) "extent takes an axis 0, 1 or 2, not " + given) ;
+}
+
+/*! \fn void ProgramFacts::checkSparse(Node *n)
+    \brief Records an error if n assigns to a cell of a Sparse matrix, or
+    iterates over something other than a Sparse matrix
+*/
+void ProgramFacts::checkSparse ( Node *n ) {
+	char where[32] ;
+	if (LongAssignStmt *a = dynamic_cast<LongAssignStmt *>(n)) {
+		if (typeOf(a->matrix()->name()) != "Sparse") return ;
+		snprintf (where, sizeof(where), "line %d: ", a->sourceLine()) ;
+		errors.push_back(where + (string) "cannot assign to a cell of the Sparse "
+		                 + a->matrix()->name()) ;
+	}
+	SparseForStmt *f = dynamic_cast<SparseForStmt *>(n) ;
+	if (f == NULL) return ;
+	snprintf (where, sizeof(where), "line %d: ", f->sourceLine()) ;
+	string t = typeOf(f->matrix()->name()) ;
+	if (t != "Sparse")
+		errors.push_back(where + (string) "for ... in needs a Sparse matrix, not "
+		                 + (t == "" ? f->matrix()->name() : t)) ;
+	if (typeOf(f->rowVariable()->name()) != "Int" || typeOf(f->colVariable()->name()) != "Int"
+	    || typeOf(f->valueVariable()->name()) != "Float")
+		errors.push_back(where + (string) "for ... in assigns an Int row, an Int column and a Float value") ;
+}
+
+/*! \fn void ProgramFacts::checkTyped(Node *n)
+    \brief Records an error if n gives a cell of a Matrix<Int> or
+    Matrix<Byte> a Float, which would be truncated, or a cell of a
+    Matrix<Byte> an Int that byteCells does not show to be in 0 .. 255,
+    which would wrap around
+*/
+void ProgramFacts::checkTyped ( Node *n ) {
+	string m, type, value ;
+	Expr *cell ;
+	int line ;
+	if (LongAssignStmt *a = dynamic_cast<LongAssignStmt *>(n)) {
+		m = a->matrix()->name() ; type = typeOf(m) ;
+		cell = a->value() ; line = a->sourceLine() ;
+	}
+	else if (LongMatrixDecl *d = dynamic_cast<LongMatrixDecl *>(n)) {
+		m = d->variable()->name() ; type = "Matrix<" + d->elementType() + ">" ;
+		cell = d->cellExpr() ; line = d->sourceLine() ;
+	}
+	else return ;
+	value = exprType(cell) ;
+	char where[32] ;
+	snprintf (where, sizeof(where), "line %d: ", line) ;
+	if (value == "Float" && (type == "Matrix<Int>" || type == "Matrix<Byte>"))
+		errors.push_back(where + (string) "cannot give a cell of the " + type + " " + m + " a Float") ;
+	else if (value == "Int" && type == "Matrix<Byte>" && !byteCells(cell))
+		errors.push_back(where + (string) "cannot give a cell of the " + type + " " + m
+		                 + " an Int that may be out of 0 .. 255") ;
+}
+
+/*! \fn void ProgramFacts::checkCall(Node *n)
+    \brief Records an error if n calls a builtin with the wrong number of
+    arguments, or is a call statement of a function other than
+    writeMatrix, whose result would be dropped; other functions, such as
+    those of math.h, are not checked for their arguments
+*/
+void ProgramFacts::checkCall ( Node *n ) {
+	if (CallStmt *s = dynamic_cast<CallStmt *>(n)) {
+		NestOrFuncExpr *f = s->callee() ;
+		if (f->function()->name() == "writeMatrix") return ;
+		char where[32] ;
+		snprintf (where, sizeof(where), "line %d: ", f->sourceLine()) ;
+		errors.push_back(where + f->function()->name() + " has no effect as a statement") ;
+		return ;
+	}
+	NestOrFuncExpr *f = dynamic_cast<NestOrFuncExpr *>(n) ;
+	if (f == NULL) return ;
+	static const struct { const char *name ; int arity ; } builtins[] = {
+		{ "numRows", 1 }, { "numCols", 1 }, { "count", 1 }, { "nnz", 1 },
+		{ "readMatrix", 1 }, { "extent", 2 }, { "matmul", 2 }, { "writeMatrix", 2 }
+	} ;
+	string fn = f->function()->name() ;
+	int given = f->secondArgument() ? 2 : 1 ;
+	for (size_t i = 0; i < sizeof(builtins) / sizeof(builtins[0]); i ++) {
+		if (fn != builtins[i].name || given == builtins[i].arity) continue ;
+		char where[32] ;
+		snprintf (where, sizeof(where), "line %d: ", f->sourceLine()) ;
+		errors.push_back(where + fn + " takes " + (builtins[i].arity == 1 ? "1 argument" : "2 arguments")
+		                 + ", not " + (given == 1 ? "1" : "2")) ;
+	}
+}
+
+/*! \fn vector<string> ProgramFacts::cellVariables(Node *n)
+    \brief The cell variables n binds, if it is a map, zip or filter
+*/
+vector<string> ProgramFacts::cellVariables ( Node *n ) {
+	vector<string> names ;
+	if (MapExpr *m = dynamic_cast<MapExpr *>(n))
+		names.push_back(m->cell()->name()) ;
+	if (ZipExpr *z = dynamic_cast<ZipExpr *>(n)) {
+		names.push_back(z->firstCell()->name()) ;
+		names.push_back(z->secondCell()->name()) ;
+	}
+	if (FilterExpr *f = dynamic_cast<FilterExpr *>(n))
+		names.push_back(f->cell()->name()) ;
+	return names ;
+}
+
+bool ProgramFacts::bindsCell ( const string &name ) {
+	return find(cells.begin(), cells.end(), name) != cells.end() ;
+}
+
+/*! \fn void ProgramFacts::check(Node *n)
+    \brief Records an error for every operator applied to a matrix and to
+    something that is neither a matrix nor a number, in n and below, in
+    source order
+*/
+void ProgramFacts::check ( Node *n ) {
+	if (n == NULL) return ;
+	vector<string> bound = cellVariables(n) ;
+	cells.insert(cells.end(), bound.begin(), bound.end()) ;
+	checkNode(n) ;
+	vector<Node *> kids ;
+	n->children(kids) ;
+	for (size_t i = 0; i < kids.size(); i ++)
+		check(kids[i]) ;
+	cells.resize(cells.size() - bound.size()) ;
+}
+
+/*! \fn void ProgramFacts::checkNode(Node *n)
+    \brief The checks of check for n itself
+*/
+void ProgramFacts::checkNode ( Node *n ) {
+	checkCollection(n) ;
+	checkParfor(n) ;
+	checkIndices(n) ;
+	checkCube(n) ;
+	checkSparse(n) ;
+	checkCall(n) ;
+	checkTyped(n) ;
+	BinOpExpr *b = dynamic_cast<BinOpExpr *>(n) ;
+	if (b == NULL) return ;
+	string op = b->opName() ;
+	string l = exprType(b->leftOperand()), r = exprType(b->rightOperand()) ;
+	char line[32] ;
+	snprintf (line, sizeof(line), "line %d: ", b->sourceLine()) ;
+	// Cubes, sparse and typed matrices are only indexed, printed and,
+	// for sparse ones, folded.
+	if (l == "Cube" || r == "Cube" || l == "Sparse" || r == "Sparse"
+	    || l.compare(0, 7, "Matrix<") == 0 || r.compare(0, 7, "Matrix<") == 0) {
+		errors.push_back(line + (string) "cannot apply " + op + " to " + l + " and " + r) ;
+		return ;
+	}
+	// Masks only combine with masks, by && and ||.
+	if ((l == "Mask" || r == "Mask") && (l != r || (op != "&&" && op != "||"))) {
+		errors.push_back(line + (string) "cannot apply " + op + " to " + l + " and " + r) ;
+		return ;
+	}
+	if (l != "Matrix" && r != "Matrix") return ;
+	if (op == "&&" || op == "||")
+		errors.push_back(line + op + " does not apply to matrices") ;
+	else if (l == "Str" || r == "Str")
+		errors.push_back(line + (string) "cannot apply " + op + " to "
+		                 + l + " and " + r) ;
+}
+
+/*! \fn static bool mentions(Node *n, const string &name)
+    \brief True if the variable name occurs anywhere in n
+*/
+static bool mentions ( Node *n, const string &name ) {
+	if (n == NULL) return false ;
+	VarName *v = dynamic_cast<VarName *>(n) ;
+	if (v && v->name() == name) return true ;
+	vector<Node *> kids ;
+	n->children(kids) ;
+	for (size_t i = 0; i < kids.size(); i ++)
+		if (mentions(kids[i], name)) return true ;
+	return false ;
+}
+
+/*! \fn static string nameOf(Expr *e)
+    \brief The variable e consists of, looking through parentheses, or "" if it is not one
+*/
+static string nameOf ( Expr *e ) {
+	while (ParenExpr *p = dynamic_cast<ParenExpr *>(e))
+		e = p->inner() ;
+	VarName *v = dynamic_cast<VarName *>(e) ;
+	return v ? v->name() : "" ;
+}
+
+/*! \fn static bool invariant(Expr *e)
+    \brief True if e is built from variables, constants and operators only,
+    so evaluating it once instead of once per iteration changes nothing
+*/
+static bool invariant ( Expr *e ) {
+	if (dynamic_cast<VarName *>(e) || dynamic_cast<AnyConst *>(e)) return true ;
+	if (ParenExpr *p = dynamic_cast<ParenExpr *>(e)) return invariant(p->inner()) ;
+	if (BinOpExpr *b = dynamic_cast<BinOpExpr *>(e))
+		return invariant(b->leftOperand()) && invariant(b->rightOperand()) ;
+	return false ;
+}
+
+/*! \fn static MatrixRefExpr *rowTerm(Expr *e, const string &k, const string &acc)
+    \brief e as M[r, k], with r not depending on k or acc, or NULL
+*/
+static MatrixRefExpr *rowTerm ( Expr *e, const string &k, const string &acc ) {
+	while (ParenExpr *p = dynamic_cast<ParenExpr *>(e))
+		e = p->inner() ;
+	MatrixRefExpr *ref = dynamic_cast<MatrixRefExpr *>(e) ;
+	if (ref == NULL || nameOf(ref->colIndex()) != k) return NULL ;
+	Expr *row = ref->rowIndex() ;
+	if (!invariant(row) || mentions(row, k) || mentions(row, acc)) return NULL ;
+	string m = ref->matrix()->name() ;
+	if (m == k || m == acc || Node::facts.typeOf(m) != "Matrix" || Node::facts.narrowed.count(m))
+		return NULL ;
+	return ref ;
+}
+
+/*! \fn static bool constantExpr(Expr *e)
+    \brief True if e is a numeric constant, possibly combined with operators
+*/
+static bool constantExpr ( Expr *e ) {
+	if (AnyConst *c = dynamic_cast<AnyConst *>(e))
+		return c->text().find('"') == string::npos ;
+	if (ParenExpr *p = dynamic_cast<ParenExpr *>(e)) return constantExpr(p->inner()) ;
+	if (BinOpExpr *b = dynamic_cast<BinOpExpr *>(e))
+		return constantExpr(b->leftOperand()) && constantExpr(b->rightOperand()) ;
+	return false ;
+}
+
+/*! \fn static bool intConstant(Expr *e)
+    \brief True if e is built from integer literals and Int variables only
+*/
+static bool intConstant ( Expr *e ) {
+	if (AnyConst *c = dynamic_cast<AnyConst *>(e))
+		return c->text().find_first_not_of("0123456789") == string::npos ;
+	if (VarName *v = dynamic_cast<VarName *>(e))
+		return Node::facts.typeOf(v->name()) == "Int" ;
+	if (ParenExpr *p = dynamic_cast<ParenExpr *>(e)) return intConstant(p->inner()) ;
+	if (BinOpExpr *b = dynamic_cast<BinOpExpr *>(e)) {
+		string op = b->opName() ;
+		return (op == "+" || op == "-" || op == "*" || op == "/")
+			&& intConstant(b->leftOperand()) && intConstant(b->rightOperand()) ;
+	}
+	return false ;
+}
+
+//! An index affine in two variables i and j, k + ci * i + cj * j, as C++ text.
+struct Affine {
+	Affine ( ) : k("0"), ci("0"), cj("0") { }
+	string k, ci, cj ;
+} ;
+
+static string affineSum ( const string &x, const string &op, const string &y ) {
+	if (y == "0") return x ;
+	if (x == "0") return op == "+" ? y : "- (" + y + ")" ;
+	return "(" + x + ") " + op + " (" + y + ")" ;
+}
+
+static string affineScale ( const string &factor, const string &x ) {
+	if (x == "0") return "0" ;
+	return x == "1" ? factor : "(" + factor + ") * (" + x + ")" ;
+}
+
+/*! \fn static bool affine(Expr *e, const string &i, const string &j, Affine &a)
+    \brief Writes e as an affine function of i and j into a, if it is one
+    with integer coefficients
+*/
+static bool affine ( Expr *e, const string &i, const string &j, Affine &a ) {
+	while (ParenExpr *p = dynamic_cast<ParenExpr *>(e))
+		e = p->inner() ;
+	string name = nameOf(e) ;
+	if (name == i) { a.ci = "1" ; return true ; }
+	if (name == j) { a.cj = "1" ; return true ; }
+	if (intConstant(e) && !mentions(e, i) && !mentions(e, j)) {
+		a.k = e->cppCode() ;
+		return true ;
+	}
+	BinOpExpr *b = dynamic_cast<BinOpExpr *>(e) ;
+	if (b == NULL) return false ;
+	string op = b->opName() ;
+	Affine x, y ;
+	if (op == "+" || op == "-") {
+		if (!affine(b->leftOperand(), i, j, x) || !affine(b->rightOperand(), i, j, y))
+			return false ;
+		a.k = affineSum(x.k, op, y.k) ;
+		a.ci = affineSum(x.ci, op, y.ci) ;
+		a.cj = affineSum(x.cj, op, y.cj) ;
+		return true ;
+	}
+	if (op != "*") return false ;
+	Expr *factor = b->leftOperand(), *rest = b->rightOperand() ;
+	if (!intConstant(factor) || mentions(factor, i) || mentions(factor, j))
+		swap(factor, rest) ;
+	if (!intConstant(factor) || mentions(factor, i) || mentions(factor, j)
+	    || !affine(rest, i, j, x))
+		return false ;
+	string f = factor->cppCode() ;
+	a.k = affineScale(f, x.k) ;
+	a.ci = affineScale(f, x.ci) ;
+	a.cj = affineScale(f, x.cj) ;
+	return true ;
+}
+
+/*! \fn static bool foldInt(Expr *e, long &value, int depth)
+    \brief Evaluates e, if it is an integer constant or built from them and
+    from Int variables assigned once with one
+*/
+static bool foldInt ( Expr *e, long &value, int depth ) {
+	if (depth > 16) return false ;
+	if (AnyConst *c = dynamic_cast<AnyConst *>(e)) {
+		string text = c->text() ;
+		if (text.empty() || text.size() > 9
+		    || text.find_first_not_of("0123456789") != string::npos)
+			return false ;
+		value = atol(text.c_str()) ;
+		return true ;
+	}
+	if (ParenExpr *p = dynamic_cast<ParenExpr *>(e)) return foldInt(p->inner(), value, depth) ;
+	if (VarName *v = dynamic_cast<VarName *>(e)) {
+		Expr *assigned = Node::facts.singleAssignment(v->name()) ;
+		return Node::facts.typeOf(v->name()) == "Int" && assigned != NULL
+			&& foldInt(assigned, value, depth + 1) ;
+	}
+	BinOpExpr *b = dynamic_cast<BinOpExpr *>(e) ;
+	long x, y ;
+	if (b == NULL || !foldInt(b->leftOperand(), x, depth) || !foldInt(b->rightOperand(), y, depth))
+		return false ;
+	string op = b->opName() ;
+	if (op == "+") value = x + y ;
+	else if (op == "-") value = x - y ;
+	else if (op == "*") value = x * y ;
+	else if (op == "/" && y != 0) value = x / y ;
+	else return false ;
+	return value > -1000000000L && value < 1000000000L ;
+}
+
+/*! \fn static Stmt *onlyStmt(Stmt *s)
+    \brief s itself, or the single statement of a block '{' Stmt '}', recursively
+*/
+static Stmt *onlyStmt ( Stmt *s ) {
+	while (BlockStmt *b = dynamic_cast<BlockStmt *>(s)) {
+		StmtsSeq *seq = dynamic_cast<StmtsSeq *>(b->body()) ;
+		if (seq == NULL || dynamic_cast<EmptyStmts *>(seq->rest()) == NULL)
+			return NULL ;
+		s = seq->first() ;
+	}
+	return s ;
+}
+
+/*! \fn static string elementAccess(string m, string i, string j)
+    \brief C++ lvalue for element (i, j) of matrix m, in the form selected by Node::options
+*/
+static string elementAccess (string m, string i, string j) {
+	if (Node::options.inlineAccess)
+		return m + ".at(" + i + ", " + j + ")" ;
+	return "*(" + m + ".access(" + i + ", " + j + "))" ;
+}
+
+/*! \fn static string sourceArgs(int line, string text)
+    \brief The line and C++ string literal of the FCAL text arguments
+    with which the checked runtime calls report a failure.
+*/
+static string sourceArgs (int line, string text) {
+	string quoted ;
+	for (size_t k = 0; k < text.size(); k ++) {
+		if (text[k] == '"' || text[k] == '\\') quoted += '\\' ;
+		if (text[k] == '\n') quoted += ' ' ;
+		else quoted += text[k] ;
+	}
+	char lineText[16] ;
+	snprintf (lineText, sizeof(lineText), "%d", line) ;
+	return (string) lineText + ", \"" + quoted + "\"" ;
+}
+
+/*! \fn static string indexAccess(string m, string i, string j, int line, string text)
+    \brief Like elementAccess, for an indexing written in the FCAL program: with
+    boundsCheck set the indices are checked at run time and a failure names
+    the source line and the FCAL text of the indexing.
+*/
+static string indexAccess (string m, string i, string j, int line, string text) {
+	if (!Node::options.boundsCheck)
+		return elementAccess (m, i, j) ;
+	return m + ".checkedAt(" + i + ", " + j + ", " + sourceArgs (line, text) + ")" ;
+}
+
 //Root
 //----------------------------------------------
 
 /*! \fn string Root::unparse()
-    \brief Unparse for root node: varName '(' ')' '{' Stmts '}'
+    \brief Unparse for root node: varName '(' [ varName ] ')' '{' Stmts '}'
 */
 string Root::unparse () {
+    if (param != NULL)
+        return varName->unparse() + " (" + param->unparse() + ") {\n" + stmts->unparse() + "\n}\n" ;
     return varName->unparse() + " () {\n" + stmts->unparse() + "\n}\n" ;
 }
+
+/*! \fn string Root::cppCode()
+    \brief Translation of the program.  With a tile parameter the body
+    becomes fcalProgram, which main hands to runTiles to run over the
+    tiles named on the command line.
+*/
 string Root::cppCode(){
-	return (string)
-	"#include <iostream>\n" +
-	"#include \"Matrix.h\"\n" +
-	"#include <math.h>\n" +
-	"using namespace std; \n" +
+	facts.collect(this) ;
+	string header = (string)
+	"#include \"fcalrt.h\"\n" +
+	"using namespace std; \n" ;
+	if (param != NULL)
+		return header +
+		"static void fcalProgram (string " + param->cppCode() + ") { \n" +
+		stmts->cppCode() +
+		"\n}\n" +
+		"int main (int argc, char **argv) { \n" +
+		"return runTiles(argc, argv, fcalProgram) ; \n" +
+		"}\n" ;
+	return header +
 	"int main () { \n" +
 	stmts->cppCode() +
 	"\n}\n";
@@ -44,6 +1002,7 @@ string SimpleDecl::cppCode(){
 	if(kwd == "Int") return (string) "int " + var->cppCode() + " ; \n";
 	if(kwd == "Float") return (string) "float " + var->cppCode() + " ; \n";
 	if(kwd == "Str") return (string) "string " + var->cppCode() + " ; \n";
+	if(kwd == "Bool") return (string) "bool " + var->cppCode() + " ; \n";
 	return "ERROR: Should not get here"; //to keep compiler quiet
 }
 
@@ -55,17 +1014,60 @@ string MatrixDecl::unparse(){
 }
 
 string MatrixDecl::cppCode(){
+	if (options.quantize) {
+		string special = quantizedCode() ;
+		if (special != "") {
+			facts.specialized.insert(var1->name()) ;
+			return special ;
+		}
+	}
 	return (string) "Matrix " + var1->cppCode() +"( " + expr1->cppCode() + " ) ; \n" ;
 }
 
+/*! \fn string MatrixDecl::quantizedCode()
+    \brief Translation of m = readMatrix(file), for an m declared once and
+    only ever indexed, as a QuantizedMatrix made from the matrix read, or
+    "" if the declaration is not of that form.  The Matrix read is a
+    temporary, so only the compact copy stays in memory.
+*/
+string MatrixDecl::quantizedCode () {
+	string m = var1->name() ;
+	NestOrFuncExpr *read = dynamic_cast<NestOrFuncExpr *>(expr1) ;
+	if (read == NULL || read->function()->name() != "readMatrix") return "" ;
+	if (!facts.onlyIndexed(m) || facts.declarations[m] != 1) return "" ;
+	facts.narrowed.insert(m) ;
+	return (string) "QuantizedMatrix " + var1->cppCode() + "( " + expr1->cppCode() + " ) ; \n" ;
+}
+
 /*! \fn string LongMatrixDecl::unparse()
     \brief Unparse for LongMatrixDecl node : 'Matrix' varName '[' Expr ',' Expr ']' varName ',' varName  '=' Expr ';'
 */
 string LongMatrixDecl::unparse(){
-       return "Matrix " + var1->unparse() + " [" + expr1->unparse() + " , " + expr2->unparse() + "] " + var2->unparse() + " , " + var3->unparse() + " = " + expr3->unparse() + "; \n";
+       string type = element == "Float" ? "Matrix " : "Matrix<" + element + "> " ;
+       return type + var1->unparse() + " [" + expr1->unparse() + " , " + expr2->unparse() + "] " + var2->unparse() + " , " + var3->unparse() + " = " + expr3->unparse() + "; \n";
 }
 
 string LongMatrixDecl::cppCode(){
+	if (element == "Double") return typedCode("double") ;
+	if (element == "Int") return typedCode("int32_t") ;
+	if (element == "Byte") return typedCode("uint8_t") ;
+	string special ;
+	if (options.triangular)
+		special = triangularCode() ;
+	if (special == "" && options.views && !options.boundsCheck)
+		special = viewCode() ;
+	if (special == "" && options.fixedSize)
+		special = fixedCode() ;
+	if (special == "" && options.narrowTypes)
+		special = narrowCode() ;
+	if (special != "") {
+		facts.specialized.insert(var1->name()) ;
+		return special ;
+	}
+	if (options.rowKernels) {
+		string kernel = rowKernelCode() ;
+		if (kernel != "") return kernel ;
+	}
 	string v1 = var1->cppCode();
 	string e1 = expr1->cppCode();
 	string v2 = var2->cppCode();
@@ -75,7 +1077,136 @@ string LongMatrixDecl::cppCode(){
 	return (string) "Matrix " + v1 + "( "+ e1 +","+ e2 +") ; \n" 
 						+ "for (int " + v2 + " = 0;" + v2 + " < " + e1 + "; " + v2 +" ++ ) { \n"
 							+ "		for (int " + v3 + " = 0;" + v3 + " < " + e2 + "; " + v3 +" ++ ) { \n" 
-								+ " 	*("+ v1 +".access(" + v2 + "," + v3 + ")) = " + expr3->cppCode() + "	;} } \n";
+								+ " 	" + elementAccess(v1, v2, v3) + " = " + expr3->cppCode() + "	;} } \n";
+}
+
+/*! \fn string MaskDecl::unparse()
+    \brief Unparse for MaskDecl node : 'Mask' varName '=' Expr ';'
+*/
+string MaskDecl::unparse(){
+       return "Mask " + var1->unparse() + " = " + expr1->unparse() + ";  \n";
+}
+
+string MaskDecl::cppCode(){
+	return (string) "Mask " + var1->cppCode() + "( " + expr1->cppCode() + " ) ; \n" ;
+}
+
+/*! \fn string LongMaskDecl::unparse()
+    \brief Unparse for LongMaskDecl node : 'Mask' varName '[' Expr ',' Expr ']' varName ',' varName  '=' Expr ';'
+*/
+string LongMaskDecl::unparse(){
+       return "Mask " + var1->unparse() + " [" + expr1->unparse() + " , " + expr2->unparse() + "] " + var2->unparse() + " , " + var3->unparse() + " = " + expr3->unparse() + "; \n";
+}
+
+/*! \fn string LongMaskDecl::cppCode()
+    \brief Translation as Mask::build, which packs 64 cells into a word
+    before storing it
+*/
+string LongMaskDecl::cppCode(){
+	return (string) "Mask " + var1->cppCode() + " = Mask::build(" + expr1->cppCode() + ", "
+		+ expr2->cppCode() + ", [&] (int " + var2->cppCode() + ", int " + var3->cppCode()
+		+ ") -> bool { return " + expr3->cppCode() + " ; }) ; \n" ;
+}
+
+/*! \fn string LongSparseDecl::unparse()
+    \brief Unparse for LongSparseDecl node : 'Sparse' varName '[' Expr ',' Expr ']' varName ',' varName  '=' Expr ';'
+*/
+string LongSparseDecl::unparse(){
+       return "Sparse " + var1->unparse() + " [" + expr1->unparse() + " , " + expr2->unparse() + "] " + var2->unparse() + " , " + var3->unparse() + " = " + expr3->unparse() + "; \n";
+}
+
+/*! \fn static bool zeroConstant(Expr *e)
+    \brief True if e is the number 0, as 0 or 0.0
+*/
+static bool zeroConstant ( Expr *e ) {
+	if (ParenExpr *p = dynamic_cast<ParenExpr *>(e)) return zeroConstant(p->inner()) ;
+	AnyConst *c = dynamic_cast<AnyConst *>(e) ;
+	return c && c->text().find_first_not_of("0.") == string::npos ;
+}
+
+/*! \fn string LongSparseDecl::cppCode()
+    \brief Translation as SparseMatrix::build.  For the guarded
+    comprehension if c then e else 0, or if c then 0 else e, the guard
+    is passed apart so that e is only evaluated where it holds.
+*/
+string LongSparseDecl::cppCode(){
+	string params = "[&] (int " + var2->cppCode() + ", int " + var3->cppCode() + ")" ;
+	string guard ;
+	Expr *cell = expr3 ;
+	while (ParenExpr *p = dynamic_cast<ParenExpr *>(cell)) cell = p->inner() ;
+	IfElseExpr *choice = dynamic_cast<IfElseExpr *>(cell) ;
+	if (choice && zeroConstant(choice->elseExpr())) {
+		guard = choice->condition()->cppCode() ;
+		cell = choice->thenExpr() ;
+	}
+	else if (choice && zeroConstant(choice->thenExpr())) {
+		guard = "! (" + choice->condition()->cppCode() + ")" ;
+		cell = choice->elseExpr() ;
+	}
+	else cell = expr3 ;
+	string code = "SparseMatrix " + var1->cppCode() + " = SparseMatrix::build(" + expr1->cppCode()
+		+ ", " + expr2->cppCode() + ", " ;
+	if (guard != "") code += params + " -> bool { return " + guard + " ; }, " ;
+	return code + params + " -> float { return " + cell->cppCode() + " ; }) ; \n" ;
+}
+
+//! The layout written in a Cube declaration, none for the default LastFastest.
+static string layoutText ( const string &layout ) {
+	return layout == "LastFastest" ? "" : "<" + layout + ">" ;
+}
+
+//! The Cube::Layout argument for layout, none for the default LastFastest.
+static string layoutArg ( const string &layout ) {
+	return layout == "LastFastest" ? "" : ", Cube::" + layout ;
+}
+
+/*! \fn string LongCubeDecl::unparse()
+    \brief Unparse for LongCubeDecl node :
+    'Cube' ['<' Layout '>'] varName '[' Expr ',' Expr ',' Expr ']' varName ',' varName ',' varName '=' Expr ';'
+*/
+string LongCubeDecl::unparse(){
+       return "Cube" + layoutText(layout) + " " + var->unparse() + " [" + extents[0]->unparse() + " , " + extents[1]->unparse()
+              + " , " + extents[2]->unparse() + "] " + indices[0]->unparse() + " , "
+              + indices[1]->unparse() + " , " + indices[2]->unparse() + " = " + cell->unparse() + "; \n";
+}
+
+/*! \fn string LongCubeDecl::cppCode()
+    \brief Translation as Cube::build, which computes the cells in the
+    order they are stored
+*/
+string LongCubeDecl::cppCode(){
+	return (string) "Cube " + var->cppCode() + " = Cube::build(" + extents[0]->cppCode() + ", "
+		+ extents[1]->cppCode() + ", " + extents[2]->cppCode() + ", [&] (int " + indices[0]->cppCode()
+		+ ", int " + indices[1]->cppCode() + ", int " + indices[2]->cppCode() + ") -> float { return "
+		+ cell->cppCode() + " ; }" + layoutArg(layout) + ") ; \n" ;
+}
+
+/*! \fn string CubeDecl::unparse()
+    \brief Unparse for CubeDecl node :
+    'Cube' ['<' Layout '>'] varName '[' Expr ',' Expr ',' Expr ']' '=' Expr ';'
+*/
+string CubeDecl::unparse(){
+       return "Cube" + layoutText(layout) + " " + var->unparse() + " [" + extents[0]->unparse() + " , "
+              + extents[1]->unparse() + " , " + extents[2]->unparse() + "] = " + source->unparse() + "; \n";
+}
+
+/*! \fn string CubeDecl::cppCode()
+    \brief Translation as a CubeView of the matrix, which copies nothing,
+    when the source is a Matrix variable, the layout is LastFastest and
+    neither is ever written; otherwise as a copy by Cube::rowsOf.
+*/
+string CubeDecl::cppCode(){
+	string c = var->cppCode() ;
+	string dims = extents[0]->cppCode() + ", " + extents[1]->cppCode() + ", " + extents[2]->cppCode() ;
+	if (VarName *m = dynamic_cast<VarName *>(source)) {
+		string base = m->name() ;
+		if (layout == "LastFastest" && facts.typeOf(base) == "Matrix" && !facts.specialized.count(base)
+		    && !facts.narrowed.count(base) && facts.readOnly(base) && facts.readOnly(var->name()))
+			return (string) "CubeView<decltype(" + base + ")> " + c + "( " + base + ", " + dims + ") ; \n" ;
+		return (string) "Cube " + c + " = Cube::rowsOf(" + base + ", " + dims + layoutArg(layout) + ") ; \n" ;
+	}
+	return (string) "Cube " + c + " = Cube::rowsOf(Matrix(" + source->cppCode() + "), " + dims
+		+ layoutArg(layout) + ") ; \n" ;
 }
 
 //Expr
@@ -103,6 +1234,8 @@ string VarName::unparse ( ) {
 
 string VarName::cppCode(){
 	if (lexeme == "readMatrix") return "Matrix::readMatrix ";
+	if (lexeme == "matmul") return "Matrix::multiply ";
+	if (lexeme == "writeMatrix") return "Matrix::writeMatrix ";
 	return (string) lexeme;
 }
 
@@ -114,6 +1247,8 @@ string AnyConst::unparse ( ) {
 } 
 
 string AnyConst::cppCode(){
+	if (constString == "True") return "true " ;
+	if (constString == "False") return "false " ;
 	return (string) constString + " "; 
 }
 
@@ -121,17 +1256,23 @@ string AnyConst::cppCode(){
     \brief Unparse for MatrixRefExpr node : varName '[' Expr ',' Expr ']'
 */
 string MatrixRefExpr::unparse(){
-       return var->unparse() + " [" + expr1->unparse() + " , " + expr2->unparse() + " ]";
+       string depth = expr3 ? " , " + expr3->unparse() : "" ;
+       return var->unparse() + " [" + expr1->unparse() + " , " + expr2->unparse() + depth + " ]";
 }
 
 string MatrixRefExpr::cppCode(){
-	return (string) "*( " + var->cppCode() + ".access(" + expr1->cppCode() + ", " + expr2->cppCode() + ")) ";
+	// The last two indices of a Cube go where the column index goes.
+	string j = expr2->cppCode() + (expr3 ? ", " + expr3->cppCode() : "") ;
+	string cell = indexAccess(var->cppCode(), expr1->cppCode(), j, line, unparse()) ;
+	if (facts.narrowed.count(var->name())) return "((float) " + cell + ") " ;
+	return cell + " ";
 }
 
 /*! \fn string NestOrFuncExpr::unparse()
-    \brief Unparse for NestOrFuncExpr node : varName '(' Expr ')'
+    \brief Unparse for NestOrFuncExpr node : varName '(' Expr ')' | varName '(' Expr ',' Expr ')'
 */
 string NestOrFuncExpr::unparse() {
+	   if (expr2) return var->unparse() + " (" + expr->unparse() + " , " + expr2->unparse() + ")";
 	   return var->unparse() + " (" + expr->unparse() + ")";
 }
 
@@ -140,6 +1281,13 @@ string NestOrFuncExpr::cppCode(){
 	{	
 		return (string) expr->cppCode()+ "." + var->cppCode() + "()"; 
 	}
+	if (var->cppCode() == "count" && expr2 == NULL) return (string) expr->cppCode() + ".count()" ;
+	if (var->cppCode() == "nnz" && expr2 == NULL) return (string) expr->cppCode() + ".nnz()" ;
+	if (var->cppCode() == "extent" && expr2 && options.boundsCheck)
+		return (string) expr->cppCode() + ".checkedExtent(" + expr2->cppCode() + ", "
+			+ sourceArgs (line, unparse()) + ")" ;
+	if (var->cppCode() == "extent" && expr2) return (string) expr->cppCode() + ".extent(" + expr2->cppCode() + ")" ;
+	if (expr2) return (string) var->cppCode() + " (" + expr->cppCode() + " , " + expr2->cppCode() + " )";
 	return (string) var->cppCode() + " (" + expr->cppCode() + " )";
 }
 
@@ -187,6 +1335,91 @@ string NotExpr::cppCode(){
   return (string) "! (" + expr->cppCode() +") ";
 }
 
+/*! \fn static bool hasLet(Node *n)
+    \brief True if n contains a let expression, whose statements may
+    assign variables and so must not run in several threads at once
+*/
+static bool hasLet ( Node *n ) {
+	if (n == NULL) return false ;
+	if (dynamic_cast<LetExpr *>(n)) return true ;
+	vector<Node *> kids ;
+	n->children(kids) ;
+	for (size_t i = 0; i < kids.size(); i ++)
+		if (hasLet(kids[i])) return true ;
+	return false ;
+}
+
+/*! \fn static string cellFunction(string params, string result, Expr *body)
+    \brief C++ lambda computing body for the cells params, followed by
+    whether the runtime may call it from several threads
+*/
+static string cellFunction ( string params, string result, Expr *body ) {
+	return "[&] (" + params + ") -> " + result + " { return " + body->cppCode()
+		+ " ; } , " + (hasLet(body) ? "false" : "true") ;
+}
+
+/*! \fn string MapExpr::unparse()
+    \brief Unparse for MapExpr node : 'map' '(' varName 'in' Expr ',' Expr ')'
+*/
+string MapExpr::unparse() {
+  return "map (" + var->unparse() + " in " + source->unparse() + " , " + body->unparse() + ")";
+}
+
+string MapExpr::cppCode(){
+  string matrix = source->cppCode() ;
+  facts.cells.push_back(var->name()) ;
+  string f = cellFunction("float " + var->cppCode(), "float", body) ;
+  facts.cells.pop_back() ;
+  return (string) "Matrix::map (" + matrix + " , " + f + ") ";
+}
+
+/*! \fn string ZipExpr::unparse()
+    \brief Unparse for ZipExpr node : 'zip' '(' varName 'in' Expr ',' varName 'in' Expr ',' Expr ')'
+*/
+string ZipExpr::unparse() {
+  return "zip (" + var1->unparse() + " in " + source1->unparse() + " , " + var2->unparse()
+	+ " in " + source2->unparse() + " , " + body->unparse() + ")";
+}
+
+string ZipExpr::cppCode(){
+  string first = source1->cppCode() ;
+  string second = source2->cppCode() ;
+  facts.cells.push_back(var1->name()) ;
+  facts.cells.push_back(var2->name()) ;
+  string f = cellFunction("float " + var1->cppCode() + ", float " + var2->cppCode(), "float", body) ;
+  facts.cells.resize(facts.cells.size() - 2) ;
+  return (string) "Matrix::zip (" + first + " , " + second + " , " + f + ") ";
+}
+
+/*! \fn string FilterExpr::unparse()
+    \brief Unparse for FilterExpr node : 'filter' '(' varName 'in' Expr ',' Expr ')'
+*/
+string FilterExpr::unparse() {
+  return "filter (" + var->unparse() + " in " + source->unparse() + " , " + cond->unparse() + ")";
+}
+
+string FilterExpr::cppCode(){
+  string matrix = source->cppCode() ;
+  facts.cells.push_back(var->name()) ;
+  string f = cellFunction("float " + var->cppCode(), "bool", cond) ;
+  facts.cells.pop_back() ;
+  return (string) "Matrix::filter (" + matrix + " , " + f + ") ";
+}
+
+/*! \fn string FoldExpr::unparse()
+    \brief Unparse for FoldExpr node : 'fold' '(' op ',' Expr [ ',' axis ] ')'
+*/
+string FoldExpr::unparse() {
+  return "fold (" + op + " , " + source->unparse() + (axis == "" ? "" : " , " + axis) + ")";
+}
+
+string FoldExpr::cppCode(){
+  string fold = axis == "rows" ? "foldRows" : axis == "cols" ? "foldCols" : "fold" ;
+  string kind = op == "+" ? "FoldSum" : op == "*" ? "FoldProduct" : op == "max" ? "FoldMax" : "FoldMin" ;
+  string owner = facts.exprType(source) == "Sparse" ? "SparseMatrix::" : "Matrix::" ;
+  return owner + fold + " (" + source->cppCode() + " , Matrix::" + kind + ") ";
+}
+
 // Stmts
 // -----------------------------------------------------------
 
@@ -209,7 +1442,9 @@ string StmtsSeq::unparse() {
 }
 
 string StmtsSeq::cppCode(){
-	return (string) stmt->cppCode() + stmts->cppCode(); //Can it be this simple? I'm not sure.
+	// In order: declarations record in facts how they were translated.
+	string first = stmt->cppCode() ;
+	return first + stmts->cppCode() ;
 }
 
 // Stmt
@@ -274,7 +1509,18 @@ string PrintStmt::unparse() {
 }
 
 string PrintStmt::cppCode(){
-	return (string) "cout << " + printExpr->cppCode() + " ; \n";
+	return (string) "fcalOut << " + printExpr->cppCode() + " ; \n";
+}
+
+/*! \fn string CallStmt::unparse()
+    \brief Unparse for CallStmt node : varName '(' Expr ',' Expr ')' ';'
+*/
+string CallStmt::unparse() {
+  return call->unparse() + "; \n" ;
+}
+
+string CallStmt::cppCode(){
+	return (string) call->cppCode() + " ; \n";
 }
 
 /*! \fn string AssignStmt::unparse()
@@ -292,12 +1538,16 @@ string AssignStmt::cppCode(){
     \brief Unparse for LongAssignStmt node : varName '[' Expr ',' Expr ']' '=' Expr ';'	
 */
 string LongAssignStmt::unparse() {
-  return var->unparse() + "["+ leftExpr1->unparse() + "," + leftExpr2->unparse() +"] = " + rightExpr->unparse() +";";
+  string depth = leftExpr3 ? "," + leftExpr3->unparse() : "" ;
+  return var->unparse() + "["+ leftExpr1->unparse() + "," + leftExpr2->unparse() + depth + "] = " + rightExpr->unparse() +";";
 }
 
 string LongAssignStmt::cppCode(){
 	//cout << var->cppCode() << endl;
-	return (string) "*("+var->cppCode() + ".access(" + leftExpr1->cppCode() + ", " + leftExpr2->cppCode() + ")) = " + rightExpr->cppCode() + " ;";
+	string target = var->unparse() + "[" + leftExpr1->unparse() + "," + leftExpr2->unparse()
+		+ (leftExpr3 ? "," + leftExpr3->unparse() : "") + "]";
+	string j = leftExpr2->cppCode() + (leftExpr3 ? ", " + leftExpr3->cppCode() : "") ;
+	return indexAccess(var->cppCode(), leftExpr1->cppCode(), j, line, target) + " = " + rightExpr->cppCode() + " ;";
 }
 
 /*! \fn string WhileStmt::unparse()
@@ -319,7 +1569,619 @@ string ForStmt::unparse() {
 }
 
 string ForStmt::cppCode(){
+       // Both rewrites skip the per-element checks, so bounds checking wins.
+       if (options.prefixSums && !options.boundsCheck) {
+              string rewritten = rectangularSum() ;
+              if (rewritten != "") return rewritten ;
+       }
+       if (options.vectorReductions && !options.boundsCheck) {
+              string rewritten = reduction() ;
+              if (rewritten != "") return rewritten ;
+       }
+       if (options.blockedMatmul && !options.boundsCheck) {
+              string rewritten = matmulCode() ;
+              if (rewritten != "") return rewritten ;
+       }
        std::string var1 = var->cppCode();
 	return (string) "for (" + var1 + " = " + expr1->cppCode() + "; " + var1 + " <= " + expr2->cppCode() + "; " + var1 + " ++ )" + statements->cppCode();
 }
  
+
+/*! \fn string ForStmt::rectangularSum()
+    \brief Translation of the loop nest
+        for (x = a : b) { for (y = c : d) { acc = acc + M[x,y]; } }
+    as one summed-area table lookup on M, or "" if this loop is not of
+    that form.  acc must be a Float, M read-only, the bounds must not
+    depend on x, y or acc, and x and y are left with the values the loops
+    would leave.
+*/
+string ForStmt::rectangularSum () {
+	ForStmt *inner = dynamic_cast<ForStmt *>(onlyStmt(statements)) ;
+	if (inner == NULL) return "" ;
+	AssignStmt *assign = dynamic_cast<AssignStmt *>(onlyStmt(inner->statements)) ;
+	if (assign == NULL) return "" ;
+	BinOpExpr *sum = dynamic_cast<BinOpExpr *>(assign->value()) ;
+	if (sum == NULL || sum->opName() != "+") return "" ;
+	MatrixRefExpr *ref = dynamic_cast<MatrixRefExpr *>(sum->rightOperand()) ;
+	if (ref == NULL) return "" ;
+
+	string x = var->name(), y = inner->var->name() ;
+	string acc = assign->target()->name() ;
+	string m = ref->matrix()->name() ;
+	if (nameOf(sum->leftOperand()) != acc || x == y || acc == x || acc == y)
+		return "" ;
+	// An Int acc truncates after every add, which one sum would not.
+	if (facts.typeOf(acc) != "Float") return "" ;
+	if (nameOf(ref->rowIndex()) != x || nameOf(ref->colIndex()) != y)
+		return "" ;
+	if (!facts.readOnly(m) || m == acc || facts.typeOf(m) != "Matrix" || facts.narrowed.count(m))
+		return "" ;
+
+	Expr *bounds[] = { expr1, expr2, inner->expr1, inner->expr2 } ;
+	for (int i = 0; i < 4; i ++)
+		if (mentions(bounds[i], x) || mentions(bounds[i], y) || mentions(bounds[i], acc))
+			return "" ;
+
+	facts.summed.insert(m) ;
+	return (string) "{ int b1_ = " + expr1->cppCode() + ", b2_ = " + expr2->cppCode()
+		+ ", b3_ = " + inner->expr1->cppCode() + ", b4_ = " + inner->expr2->cppCode() + " ; \n"
+		+ acc + " = " + acc + " + " + m + ".prefixSums().rect(b1_, b2_, b3_, b4_) ; \n"
+		+ "if (b1_ <= b2_) " + y + " = (b3_ <= b4_) ? b4_ + 1 : b3_ ; \n"
+		+ x + " = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } \n" ;
+}
+
+/*! \fn string ForStmt::reduction()
+    \brief Translation of a loop over k that reduces rows of matrices into
+    a Float acc, or "" if this loop is not one.  Recognized bodies are
+        acc = acc + M[r, k] - N[s, k] ... ;
+        acc = if (acc < M[r, k]) then M[r, k] else acc ;
+    and the other orderings of the comparison, giving maximum or minimum.
+    The rows are reduced by Matrix::rowSum, rowMax and rowMin.
+*/
+string ForStmt::reduction () {
+	AssignStmt *assign = dynamic_cast<AssignStmt *>(onlyStmt(statements)) ;
+	if (assign == NULL) return "" ;
+	string k = var->name(), acc = assign->target()->name() ;
+	if (k == acc || facts.typeOf(acc) != "Float") return "" ;
+	if (mentions(expr1, k) || mentions(expr1, acc) || mentions(expr2, k) || mentions(expr2, acc))
+		return "" ;
+
+	string value ;
+	Expr *e = assign->value() ;
+	if (IfElseExpr *choice = dynamic_cast<IfElseExpr *>(e)) {
+		// acc = if (L op R) then X else Y, with {L, R} = {X, Y} = {acc, M[r, k]}
+		BinOpExpr *cmp = dynamic_cast<BinOpExpr *>(choice->condition()) ;
+		if (cmp == NULL) return "" ;
+		string op = cmp->opName() ;
+		bool less = op == "<" || op == "<=" ;
+		if (!less && op != ">" && op != ">=") return "" ;
+		MatrixRefExpr *ref = NULL ;
+		bool accLeft = nameOf(cmp->leftOperand()) == acc ;
+		if (accLeft) ref = rowTerm(cmp->rightOperand(), k, acc) ;
+		else if (nameOf(cmp->rightOperand()) == acc) ref = rowTerm(cmp->leftOperand(), k, acc) ;
+		if (ref == NULL) return "" ;
+		string term = ref->unparse() ;
+		Expr *x = choice->thenExpr(), *y = choice->elseExpr() ;
+		while (ParenExpr *p = dynamic_cast<ParenExpr *>(x)) x = p->inner() ;
+		while (ParenExpr *p = dynamic_cast<ParenExpr *>(y)) y = p->inner() ;
+		bool thenTerm = nameOf(y) == acc && x->unparse() == term ;
+		bool thenAcc = nameOf(x) == acc && y->unparse() == term ;
+		if (!thenTerm && !thenAcc) return "" ;
+		// The then branch holds the right operand of < and the left of >.
+		bool thenRight = thenTerm == accLeft ;
+		bool max = less == thenRight ;
+		value = ref->matrix()->cppCode() + (max ? ".rowMax(" : ".rowMin(")
+			+ ref->rowIndex()->cppCode() + ", b1_, b2_, " + acc + ")" ;
+	} else {
+		// acc = acc +/- M[r, k] +/- ... ; the terms hang off the left spine.
+		string terms ;
+		while (BinOpExpr *b = dynamic_cast<BinOpExpr *>(e)) {
+			string op = b->opName() ;
+			MatrixRefExpr *ref = rowTerm(b->rightOperand(), k, acc) ;
+			if ((op != "+" && op != "-") || ref == NULL) return "" ;
+			terms = " " + op + " " + ref->matrix()->cppCode() + ".rowSum("
+				+ ref->rowIndex()->cppCode() + ", b1_, b2_)" + terms ;
+			e = b->leftOperand() ;
+			while (ParenExpr *p = dynamic_cast<ParenExpr *>(e)) e = p->inner() ;
+		}
+		if (terms == "" || nameOf(e) != acc) return "" ;
+		value = acc + terms ;
+	}
+
+	return (string) "{ int b1_ = " + expr1->cppCode() + ", b2_ = " + expr2->cppCode() + " ; \n"
+		+ acc + " = " + value + " ; \n"
+		+ k + " = (b1_ <= b2_) ? b2_ + 1 : b1_ ; } \n" ;
+}
+
+/*! \fn string LongMatrixDecl::triangularCode()
+    \brief Translation of a comprehension whose guard makes one triangle
+    a constant, or the mirror image of the other, as a TriangularMatrix,
+    or "" if it is not of that form.  Recognized are
+        Matrix c[r, s] i, j = if j <= i then 0.0 else e ;
+    with any of <, <=, >, >= and the operands or branches either way
+    round, and the square symmetric form
+        Matrix c[n, n] i, j = if j < i then c[j, i] else e ;
+    The matrix must only ever be indexed, never written or passed whole.
+*/
+string LongMatrixDecl::triangularCode () {
+	string m = var1->name(), i = var2->name(), j = var3->name() ;
+	IfElseExpr *choice = dynamic_cast<IfElseExpr *>(expr3) ;
+	if (choice == NULL || i == j || !facts.onlyIndexed(m)) return "" ;
+	BinOpExpr *cmp = dynamic_cast<BinOpExpr *>(choice->condition()) ;
+	if (cmp == NULL) return "" ;
+
+	// Bring the guard into the form j op i.
+	string op = cmp->opName() ;
+	string left = nameOf(cmp->leftOperand()), right = nameOf(cmp->rightOperand()) ;
+	if (op != "<" && op != "<=" && op != ">" && op != ">=") return "" ;
+	if (left == i && right == j) {
+		if (op[0] == '<') op[0] = '>' ; else op[0] = '<' ;
+	} else if (left != j || right != i) return "" ;
+
+	// guarded: the branch taken in the guard's half, e the other one.
+	Expr *guarded = choice->thenExpr(), *e = choice->elseExpr() ;
+	bool swapped = !constantExpr(guarded) ;
+	MatrixRefExpr *mirror = dynamic_cast<MatrixRefExpr *>(guarded) ;
+	bool symmetric = mirror && mirror->matrix()->name() == m
+		&& nameOf(mirror->rowIndex()) == j && nameOf(mirror->colIndex()) == i ;
+	if (swapped && !symmetric) {
+		// if j op i then e else constant: the constant half is the negation.
+		guarded = choice->elseExpr() ;
+		e = choice->thenExpr() ;
+		if (!constantExpr(guarded)) return "" ;
+		if (op == "<") op = ">=" ; else if (op == "<=") op = ">" ;
+		else if (op == ">") op = "<=" ; else op = "<" ;
+		symmetric = false ;
+	}
+
+	// The constant or mirrored half is j op i; the stored one the rest.
+	string half = op[0] == '<' ? "TriangularMatrix::Upper" : "TriangularMatrix::Lower" ;
+	string shift = op.size() == 2 ? "1" : "0" ;
+	if (symmetric && (op != "<" || expr1->unparse() != expr2->unparse())) return "" ;
+
+	string e1 = expr1->cppCode(), e2 = expr2->cppCode() ;
+	string fill = symmetric ? "0" : guarded->cppCode() ;
+	return (string) "TriangularMatrix " + m + "( " + e1 + "," + e2 + ", " + half + ", "
+		+ shift + ", " + fill + (symmetric ? ", true" : "") + ") ; \n"
+		+ "for (int " + i + " = 0;" + i + " < " + e1 + "; " + i + " ++ ) { \n"
+		+ "		for (int " + j + " = " + m + ".firstCol(" + i + ");" + j + " <= " + m
+		+ ".lastCol(" + i + "); " + j + " ++ ) { \n"
+		+ " 	" + elementAccess(m, i, j) + " = " + e->cppCode() + "	;} } \n" ;
+}
+
+/*! \fn string LongMatrixDecl::viewCode()
+    \brief Translation of a comprehension that only reads another matrix
+    at indices affine in its own, such as
+        Matrix t[c, r] i, j = m[j, i] ;
+        Matrix row[k, w] i, j = data[r, i * w + j] ;
+    as a MatrixView of that matrix, or "" if it is not of that form.
+    Guarded comprehensions, e.g. against reading past the end, are not
+    of that form and are copied as before.  Neither matrix may ever be
+    written, and the view must only be indexed.
+*/
+string LongMatrixDecl::viewCode () {
+	string m = var1->name(), i = var2->name(), j = var3->name() ;
+	Expr *e = expr3 ;
+	while (ParenExpr *p = dynamic_cast<ParenExpr *>(e))
+		e = p->inner() ;
+	MatrixRefExpr *ref = dynamic_cast<MatrixRefExpr *>(e) ;
+	if (ref == NULL || i == j) return "" ;
+	string base = ref->matrix()->name() ;
+	if (base == m || base == i || base == j || facts.typeOf(base) != "Matrix"
+	    || facts.narrowed.count(base))
+		return "" ;
+	if (!facts.onlyIndexed(m) || !facts.readOnly(base)) return "" ;
+	Affine r, c ;
+	if (!affine(ref->rowIndex(), i, j, r) || !affine(ref->colIndex(), i, j, c)) return "" ;
+
+	return (string) "MatrixView<decltype(" + base + ")> " + m + "( " + base + ", "
+		+ expr1->cppCode() + ", " + expr2->cppCode() + ", "
+		+ r.k + ", " + r.ci + ", " + r.cj + ", " + c.k + ", " + c.ci + ", " + c.cj + ") ; \n" ;
+}
+
+//! Largest number of cells of a FixedMatrix, which lives on the stack.
+static const long maxFixedCells = 1024 ;
+
+/*! \fn string LongMatrixDecl::fixedCode()
+    \brief Translation of a comprehension whose dimensions fold to small
+    constants as a FixedMatrix filled by loops with constant bounds, or ""
+    if they do not fold or the matrix is used whole, e.g. printed.
+*/
+string LongMatrixDecl::fixedCode () {
+	long rows, cols ;
+	string m = var1->name() ;
+	if (!foldInt(expr1, rows) || !foldInt(expr2, cols) || facts.usedWhole(m)) return "" ;
+	if (rows < 1 || cols < 1 || rows * cols > maxFixedCells) return "" ;
+
+	char dims[64] ;
+	snprintf (dims, sizeof(dims), "%ld", rows) ;
+	string r = dims ;
+	snprintf (dims, sizeof(dims), "%ld", cols) ;
+	string c = dims ;
+	string i = var2->cppCode(), j = var3->cppCode() ;
+	return (string) "FixedMatrix<" + r + ", " + c + "> " + m + " ; \n"
+		+ "for (int " + i + " = 0;" + i + " < " + r + "; " + i + " ++ ) { \n"
+		+ "		for (int " + j + " = 0;" + j + " < " + c + "; " + j + " ++ ) { \n"
+		+ " 	" + elementAccess(m, i, j) + " = " + expr3->cppCode() + "	;} } \n" ;
+}
+
+/*! \fn string LongMatrixDecl::typedCode(const string &cell)
+    \brief Translation of a comprehension as a TypedMatrix of cells of
+    C++ type cell, filled by the same loops as a Matrix
+*/
+string LongMatrixDecl::typedCode (const string &cell) {
+	string m = var1->cppCode(), e1 = expr1->cppCode(), e2 = expr2->cppCode() ;
+	string i = var2->cppCode(), j = var3->cppCode() ;
+	return (string) "TypedMatrix<" + cell + "> " + m + "( " + e1 + "," + e2 + ") ; \n"
+		+ "for (int " + i + " = 0;" + i + " < " + e1 + "; " + i + " ++ ) { \n"
+		+ "		for (int " + j + " = 0;" + j + " < " + e2 + "; " + j + " ++ ) { \n"
+		+ " 	" + elementAccess(m, i, j) + " = " + expr3->cppCode() + "	;} } \n" ;
+}
+
+/*! \fn static bool byteCells(Expr *e)
+    \brief True if every value of e is known to lie in 0 .. 255: e is
+    Bool, or folds to such a constant, or chooses between such values
+*/
+static bool byteCells ( Expr *e ) {
+	while (ParenExpr *p = dynamic_cast<ParenExpr *>(e)) e = p->inner() ;
+	if (Node::facts.exprType(e) == "Bool") return true ;
+	if (IfElseExpr *choice = dynamic_cast<IfElseExpr *>(e))
+		return byteCells(choice->thenExpr()) && byteCells(choice->elseExpr()) ;
+	long value ;
+	return foldInt(e, value) && value >= 0 && value <= 255 ;
+}
+
+/*! \fn string LongMatrixDecl::narrowCode()
+    \brief Translation of a read-only comprehension, only ever indexed,
+    whose cells are Int or Bool, as a TypedMatrix of uint8_t if byteCells
+    holds and of int32_t otherwise, or "" if it is not of that kind.  The
+    cells are those the float Matrix would hold before rounding, and are
+    read back as float, so the program computes the same values.
+*/
+string LongMatrixDecl::narrowCode () {
+	string m = var1->name() ;
+	if (!facts.onlyIndexed(m) || facts.declarations[m] != 1) return "" ;
+	string t = facts.exprType(expr3) ;
+	if (t != "Int" && t != "Bool") return "" ;
+	facts.narrowed.insert(m) ;
+	return typedCode(byteCells(expr3) ? "uint8_t" : "int32_t") ;
+}
+
+/*! \fn static void declaredIn(Node *n, set<string> &names)
+    \brief Adds to names every variable declared inside n, including the
+    index and cell variables of comprehensions, map, zip and filter
+*/
+static void declaredIn ( Node *n, set<string> &names ) {
+	if (n == NULL) return ;
+	if (SimpleDecl *d = dynamic_cast<SimpleDecl *>(n)) names.insert(d->variable()->name()) ;
+	if (MatrixDecl *d = dynamic_cast<MatrixDecl *>(n)) names.insert(d->variable()->name()) ;
+	if (MaskDecl *d = dynamic_cast<MaskDecl *>(n)) names.insert(d->variable()->name()) ;
+	if (LongMatrixDecl *d = dynamic_cast<LongMatrixDecl *>(n)) {
+		names.insert(d->variable()->name()) ;
+		names.insert(d->rowVariable()->name()) ;
+		names.insert(d->colVariable()->name()) ;
+	}
+	if (LongMaskDecl *d = dynamic_cast<LongMaskDecl *>(n)) {
+		names.insert(d->variable()->name()) ;
+		names.insert(d->rowVariable()->name()) ;
+		names.insert(d->colVariable()->name()) ;
+	}
+	if (LongSparseDecl *d = dynamic_cast<LongSparseDecl *>(n)) {
+		names.insert(d->variable()->name()) ;
+		names.insert(d->rowVariable()->name()) ;
+		names.insert(d->colVariable()->name()) ;
+	}
+	if (CubeDecl *d = dynamic_cast<CubeDecl *>(n)) names.insert(d->variable()->name()) ;
+	if (LongCubeDecl *d = dynamic_cast<LongCubeDecl *>(n)) {
+		names.insert(d->variable()->name()) ;
+		for (int axis = 0; axis < 3; axis ++) names.insert(d->index(axis)->name()) ;
+	}
+	if (MapExpr *m = dynamic_cast<MapExpr *>(n)) names.insert(m->cell()->name()) ;
+	if (ZipExpr *z = dynamic_cast<ZipExpr *>(n)) {
+		names.insert(z->firstCell()->name()) ;
+		names.insert(z->secondCell()->name()) ;
+	}
+	if (FilterExpr *f = dynamic_cast<FilterExpr *>(n)) names.insert(f->cell()->name()) ;
+	vector<Node *> kids ;
+	n->children(kids) ;
+	for (size_t i = 0; i < kids.size(); i ++)
+		declaredIn(kids[i], names) ;
+}
+
+/*! \fn static string buildSums(Node *body, set<string> &summed)
+    \brief Statements building the summed-area tables of the matrices in
+    summed that are not declared inside body, which several threads then
+    only read.  Merges summed into facts.summed.
+*/
+static string buildSums ( Node *body, set<string> &summed ) {
+	set<string> local ;
+	declaredIn(body, local) ;
+	string code ;
+	for (set<string>::iterator i = summed.begin(); i != summed.end(); i ++)
+		if (local.count(*i) == 0) code += *i + ".prefixSums() ; \n" ;
+	Node::facts.summed.insert(summed.begin(), summed.end()) ;
+	return code ;
+}
+
+/*! \fn static bool rowLocal(Node *n, const string &row, const set<string> &local)
+    \brief True if n, part of a comprehension over rows row, only indexes
+    the matrices not in local at row row, only uses them whole as the
+    argument of numRows and numCols, assigns only variables in local, and
+    has no print or call statement, such as writeMatrix.  Other functions,
+    such as readMatrix or matmul, are allowed if all their arguments are.
+*/
+static bool rowLocal ( Node *n, const string &row, const set<string> &local ) {
+	if (n == NULL) return true ;
+	if (dynamic_cast<PrintStmt *>(n) || dynamic_cast<CallStmt *>(n)
+	    || dynamic_cast<ParforStmt *>(n))
+		return false ;
+	vector<string> targets ;
+	if (AssignStmt *a = dynamic_cast<AssignStmt *>(n)) targets.push_back(a->target()->name()) ;
+	if (LongAssignStmt *a = dynamic_cast<LongAssignStmt *>(n)) targets.push_back(a->matrix()->name()) ;
+	if (ForStmt *f = dynamic_cast<ForStmt *>(n)) targets.push_back(f->variable()->name()) ;
+	if (SparseForStmt *f = dynamic_cast<SparseForStmt *>(n)) {
+		targets.push_back(f->rowVariable()->name()) ;
+		targets.push_back(f->colVariable()->name()) ;
+		targets.push_back(f->valueVariable()->name()) ;
+	}
+	for (size_t i = 0; i < targets.size(); i ++)
+		if (local.count(targets[i]) == 0) return false ;
+
+	vector<Node *> kids ;
+	if (MatrixRefExpr *r = dynamic_cast<MatrixRefExpr *>(n)) {
+		if (local.count(r->matrix()->name()) == 0 && nameOf(r->rowIndex()) != row) return false ;
+		kids.push_back(r->rowIndex()) ;
+		kids.push_back(r->colIndex()) ;
+		kids.push_back(r->depthIndex()) ;
+	}
+	else if (NestOrFuncExpr *f = dynamic_cast<NestOrFuncExpr *>(n)) {
+		string fn = f->function()->name() ;
+		if (fn != "numRows" && fn != "numCols") kids.push_back(f->argument()) ;
+		kids.push_back(f->secondArgument()) ;
+	}
+	else if (VarName *v = dynamic_cast<VarName *>(n)) {
+		string t = Node::facts.typeOf(v->name()) ;
+		if (local.count(v->name()) == 0 && t != "Int" && t != "Float" && t != "Bool" && t != "Str")
+			return false ;
+	}
+	else n->children(kids) ;
+	for (size_t i = 0; i < kids.size(); i ++)
+		if (!rowLocal(kids[i], row, local)) return false ;
+	return true ;
+}
+
+//! True while translating the cells of a row kernel, whose comprehensions
+//! are then translated as loops rather than as kernels of their own.
+static bool inRowKernel = false ;
+
+/*! \fn string LongMatrixDecl::rowKernelCode()
+    \brief Translation of a comprehension whose cell expression is
+    rowLocal as a kernel lambda over (row, col), which rowKernelRun calls
+    for blocks of rows from several threads, or "" if it is not of that
+    kind.  The cells must not read the matrix being built.
+*/
+string LongMatrixDecl::rowKernelCode () {
+	if (inRowKernel) return "" ;
+	set<string> local ;
+	declaredIn(expr3, local) ;
+	string m = var1->name(), row = var2->name() ;
+	if (local.count(m) || local.count(row) || row == var3->name()) return "" ;
+	local.insert(var3->name()) ;
+	if (mentions(expr3, m) || !rowLocal(expr3, row, local)) return "" ;
+	string v1 = var1->cppCode() ;
+	inRowKernel = true ;
+	string cell = expr3->cppCode() ;
+	inRowKernel = false ;
+	return (string) "Matrix " + v1 + "( " + expr1->cppCode() + "," + expr2->cppCode() + ") ; \n"
+		+ "auto " + v1 + "_kernel = [&] (int " + var2->cppCode() + ", int " + var3->cppCode()
+		+ ") -> float { return " + cell + " ; } ; \n"
+		+ "rowKernelRun(" + v1 + ", " + v1 + "_kernel) ; \n" ;
+}
+
+/*! \fn string ForStmt::matmulCode()
+    \brief Translation of the matrix multiplication loop nest
+        for (i = ..) { for (j = ..) { for (k = ..) {
+            c[i, j] = c[i, j] + a[i, k] * b[k, j] ; } } }
+    in any order of the three loops, as one Matrix::multiplyAdd call, or
+    "" if this loop is not of that form.  c, a and b must be plain
+    Matrix objects, c neither a nor b, and the bounds must not depend on
+    the loop variables or c.  multiplyAdd adds the products to each c[i, j]
+    in increasing k like the loops do, so the results are the same.
+*/
+string ForStmt::matmulCode () {
+	ForStmt *loops[3] = { this, NULL, NULL } ;
+	for (int l = 1; l < 3; l ++) {
+		loops[l] = dynamic_cast<ForStmt *>(onlyStmt(loops[l - 1]->statements)) ;
+		if (loops[l] == NULL) return "" ;
+	}
+	LongAssignStmt *assign = dynamic_cast<LongAssignStmt *>(onlyStmt(loops[2]->statements)) ;
+	if (assign == NULL) return "" ;
+	BinOpExpr *sum = dynamic_cast<BinOpExpr *>(assign->value()) ;
+	if (sum == NULL || sum->opName() != "+") return "" ;
+	MatrixRefExpr *acc = dynamic_cast<MatrixRefExpr *>(sum->leftOperand()) ;
+	Expr *rhs = sum->rightOperand() ;
+	while (ParenExpr *p = dynamic_cast<ParenExpr *>(rhs))
+		rhs = p->inner() ;
+	BinOpExpr *product = dynamic_cast<BinOpExpr *>(rhs) ;
+	if (acc == NULL || product == NULL || product->opName() != "*") return "" ;
+	MatrixRefExpr *a = dynamic_cast<MatrixRefExpr *>(product->leftOperand()) ;
+	MatrixRefExpr *b = dynamic_cast<MatrixRefExpr *>(product->rightOperand()) ;
+	if (a == NULL || b == NULL) return "" ;
+
+	string c = assign->matrix()->name() ;
+	string i = nameOf(assign->rowIndex()), j = nameOf(assign->colIndex()) ;
+	if (acc->matrix()->name() != c || nameOf(acc->rowIndex()) != i || nameOf(acc->colIndex()) != j)
+		return "" ;
+	// The factors may come either way round: a[i, k] * b[k, j] or b[k, j] * a[i, k].
+	if (nameOf(a->rowIndex()) != i) swap(a, b) ;
+	string k = nameOf(a->colIndex()) ;
+	if (nameOf(a->rowIndex()) != i || nameOf(b->rowIndex()) != k || nameOf(b->colIndex()) != j)
+		return "" ;
+
+	string names[3] = { i, j, k } ;
+	int loopOf[3] ;
+	for (int n = 0; n < 3; n ++) {
+		loopOf[n] = -1 ;
+		for (int l = 0; l < 3; l ++)
+			if (loops[l]->var->name() == names[n]) loopOf[n] = l ;
+		if (names[n] == "" || loopOf[n] < 0) return "" ;
+	}
+	if (i == j || j == k || i == k) return "" ;
+
+	string ma = a->matrix()->name(), mb = b->matrix()->name() ;
+	string matrices[3] = { c, ma, mb } ;
+	for (int m = 0; m < 3; m ++)
+		if (facts.typeOf(matrices[m]) != "Matrix" || facts.specialized.count(matrices[m]))
+			return "" ;
+	if (c == ma || c == mb) return "" ;
+	for (int l = 0; l < 3; l ++) {
+		Expr *bounds[2] = { loops[l]->expr1, loops[l]->expr2 } ;
+		for (int e = 0; e < 2; e ++)
+			for (int n = 0; n < 3; n ++)
+				if (mentions(bounds[e], names[n]) || mentions(bounds[e], c)) return "" ;
+	}
+
+	// lo1_, hi1_ are the bounds of the outermost loop, lo3_, hi3_ of the innermost.
+	string code = "{ int " ;
+	for (int l = 0; l < 3; l ++) {
+		char n = '1' + l ;
+		code += (string) (l ? ", " : "") + "lo" + n + "_ = " + loops[l]->expr1->cppCode()
+			+ ", hi" + n + "_ = " + loops[l]->expr2->cppCode() ;
+	}
+	string lo[3], hi[3] ;
+	for (int n = 0; n < 3; n ++) {
+		char l = '1' + loopOf[n] ;
+		lo[n] = (string) "lo" + l + "_" ;
+		hi[n] = (string) "hi" + l + "_" ;
+	}
+	code += " ; \n" ;
+	code += "Matrix::multiplyAdd(" + c + ", " + ma + ", " + mb + ", " + lo[0] + ", " + hi[0] + ", "
+		+ lo[1] + ", " + hi[1] + ", " + lo[2] + ", " + hi[2] + ") ; \n" ;
+	code += "if (lo1_ <= hi1_) { if (lo2_ <= hi2_) " + loops[2]->var->name()
+		+ " = (lo3_ <= hi3_) ? hi3_ + 1 : lo3_ ; \n"
+		+ loops[1]->var->name() + " = (lo2_ <= hi2_) ? hi2_ + 1 : lo2_ ; } \n"
+		+ loops[0]->var->name() + " = (lo1_ <= hi1_) ? hi1_ + 1 : lo1_ ; } \n" ;
+	return code ;
+}
+
+/*! \fn string ParforStmt::unparse()
+    \brief Unparse for ParforStmt node :
+    'parfor' '(' varName '=' Expr ':' Expr ')' { 'reduce' '(' op ':' varName ')' } Stmt
+*/
+string ParforStmt::unparse() {
+	string code = "parfor (" + var->unparse() + " = " + expr1->unparse() + ":" + expr2->unparse() + ") " ;
+	for (size_t i = 0; i < reduced.size(); i ++)
+		code += "reduce (" + ops[i] + " : " + reduced[i]->unparse() + ") " ;
+	return code + "\n" + statements->unparse() ;
+}
+
+/*! \fn set<string> ParforStmt::assigned()
+    \brief The variables declared outside the body that it assigns whole,
+    or runs a loop over, other than the reductions
+*/
+set<string> ParforStmt::assigned () {
+	set<string> targets, declared ;
+	vector<Node *> work ;
+	work.push_back(statements) ;
+	while (!work.empty()) {
+		Node *n = work.back() ;
+		work.pop_back() ;
+		if (n == NULL) continue ;
+		if (AssignStmt *a = dynamic_cast<AssignStmt *>(n)) targets.insert(a->target()->name()) ;
+		if (ForStmt *f = dynamic_cast<ForStmt *>(n)) targets.insert(f->variable()->name()) ;
+		if (ParforStmt *f = dynamic_cast<ParforStmt *>(n)) targets.insert(f->variable()->name()) ;
+		if (SparseForStmt *f = dynamic_cast<SparseForStmt *>(n)) {
+			targets.insert(f->rowVariable()->name()) ;
+			targets.insert(f->colVariable()->name()) ;
+			targets.insert(f->valueVariable()->name()) ;
+		}
+		if (SimpleDecl *d = dynamic_cast<SimpleDecl *>(n)) declared.insert(d->variable()->name()) ;
+		if (MatrixDecl *d = dynamic_cast<MatrixDecl *>(n)) declared.insert(d->variable()->name()) ;
+		if (LongMatrixDecl *d = dynamic_cast<LongMatrixDecl *>(n)) declared.insert(d->variable()->name()) ;
+		n->children(work) ;
+	}
+	set<string> result ;
+	for (set<string>::iterator i = targets.begin(); i != targets.end(); i ++) {
+		bool reduction = false ;
+		for (size_t r = 0; r < reduced.size(); r ++)
+			if (reduced[r]->name() == *i) reduction = true ;
+		if (!reduction && declared.count(*i) == 0 && *i != var->name()) result.insert(*i) ;
+	}
+	return result ;
+}
+
+/*! \fn string SparseForStmt::unparse()
+    \brief Unparse for SparseForStmt node : 'for' '(' varName ',' varName ',' varName 'in' varName ')' Stmt
+*/
+string SparseForStmt::unparse() {
+  return "for (" + row->unparse() + " , " + col->unparse() + " , " + value->unparse() + " in "
+         + source->unparse() + ") \n" + statements->unparse();
+}
+
+/*! \fn string SparseForStmt::cppCode()
+    \brief Translation as a loop over the rows of the matrix and, inside
+    it, over the stored cells of the row, so the work is in the number of
+    rows and stored cells rather than rows * cols
+*/
+string SparseForStmt::cppCode() {
+  string m = source->cppCode(), i = row->cppCode() ;
+  return "for (" + i + " = 0; " + i + " < " + m + ".numRows(); " + i + " ++ ) \n"
+    + "for (int nz_ = " + m + ".rowBegin(" + i + "); nz_ < " + m + ".rowEnd(" + i + "); nz_ ++ ) { \n"
+    + col->cppCode() + " = " + m + ".column(nz_) ; \n"
+    + value->cppCode() + " = " + m + ".value(nz_) ; \n"
+    + statements->cppCode() + "\n} \n" ;
+}
+
+/*! \fn string ParforStmt::cppCode()
+    \brief Translation as a parforRun over a fixed number of parts of the
+    range, in a lambda that declares private copies of the loop variable,
+    of the variables the body assigns and of the reductions.  Each part
+    leaves its reductions in partials_v_, which are combined in a fixed
+    order after the loop, so the result does not depend on the threads.
+    The loop variable and the private copies are left unchanged, and the
+    summed-area tables the body looks up are built before the threads.
+*/
+string ParforStmt::cppCode() {
+	static const char *foldOps[][2] = { { "+", "Matrix::FoldSum" }, { "*", "Matrix::FoldProduct" },
+	                                    { "max", "Matrix::FoldMax" }, { "min", "Matrix::FoldMin" } } ;
+	vector<string> folds ;
+	for (size_t i = 0; i < ops.size(); i ++)
+		for (size_t k = 0; k < 4; k ++)
+			if (ops[i] == foldOps[k][0]) folds.push_back(foldOps[k][1]) ;
+	set<string> privates = assigned() ;
+	set<string> summed ;
+	summed.swap(facts.summed) ;
+	string body = statements->cppCode() ;
+	summed.swap(facts.summed) ;
+
+	string code = "{ int first_ = " + expr1->cppCode() + ", last_ = " + expr2->cppCode() + " ; \n"
+		+ buildSums(statements, summed)
+		+ "int parts_ = parforPartCount(first_, last_) ; \n" ;
+	for (size_t i = 0; i < reduced.size(); i ++) {
+		string v = reduced[i]->cppCode() ;
+		code += "std::vector<decltype(" + v + ")> partials_" + v + "_ (parts_, reductionIdentity<decltype("
+			+ v + ")>(" + folds[i] + ")) ; \n" ;
+	}
+	for (set<string>::iterator i = privates.begin(); i != privates.end(); i ++)
+		code += "auto shared_" + *i + "_ = " + *i + " ; \n" ;
+	code += "parforRun(first_, last_, parts_, [&] (int part_, int lo_, int hi_) { \n" ;
+	for (size_t i = 0; i < reduced.size(); i ++) {
+		string v = reduced[i]->cppCode() ;
+		code += "auto " + v + " = partials_" + v + "_[part_] ; \n" ;
+	}
+	for (set<string>::iterator i = privates.begin(); i != privates.end(); i ++)
+		code += "auto " + *i + " = shared_" + *i + "_ ; \n" ;
+	string v = var->cppCode() ;
+	code += "int " + v + " ; \n"
+		+ "for (" + v + " = lo_; " + v + " <= hi_; " + v + " ++ )" + body + "\n" ;
+	for (size_t i = 0; i < reduced.size(); i ++) {
+		string r = reduced[i]->cppCode() ;
+		code += "partials_" + r + "_[part_] = " + r + " ; \n" ;
+	}
+	code += "} ) ; \n" ;
+	for (size_t i = 0; i < reduced.size(); i ++) {
+		string r = reduced[i]->cppCode() ;
+		code += r + " = combinePartials(partials_" + r + "_, " + r + ", " + folds[i] + ") ; \n" ;
+	}
+	return code + "} \n" ;
+}
@@ -10,6 +10,9 @@
 
 #include <string>
 #include <iostream> 
+#include <vector>
+#include <set>
+#include <map>
 
 #include "scanner.h"
 
@@ -20,6 +23,119 @@ class Root ;
 class Stmts ;
 class Stmt ;
 class VarName;
+class NestOrFuncExpr;
+
+//CodeGenOptions
+//! Switches selecting between alternative C++ translations of the same program.
+class CodeGenOptions {
+	public:
+		CodeGenOptions() : inlineAccess(false), boundsCheck(false), prefixSums(false),
+			vectorReductions(false), triangular(false), views(false), fixedSize(false),
+			blockedMatmul(false), narrowTypes(false), quantize(false), rowKernels(false) { } ;
+		//! Emit m.at(i, j) from the header instead of *(m.access(i, j)).
+		bool inlineAccess ;
+		//! Emit Matrix::checkedAt for every indexing written in the program,
+		//! reporting out of range indices with their source line.
+		bool boundsCheck ;
+		//! Rewrite double loops summing a rectangle of a read-only matrix
+		//! into summed-area table lookups.  Reassociates the sum.
+		bool prefixSums ;
+		//! Rewrite single loops that sum, or take the maximum or minimum
+		//! of, a row of a matrix into calls to the vectorized kernels of
+		//! the runtime.  Reassociates sums, so results may differ in the
+		//! last bits.
+		bool vectorReductions ;
+		//! Store comprehensions such as [n, n] i, j = if j <= i then 0.0 else e
+		//! as a packed TriangularMatrix, if they are only ever indexed.
+		bool triangular ;
+		//! Bind comprehensions such as [c, r] i, j = m[j, i], whose indices are
+		//! affine in i and j, to a MatrixView of m instead of copying m.
+		bool views ;
+		//! Declare comprehensions whose dimensions fold to small constants
+		//! as FixedMatrix<rows, cols>, held on the stack.
+		bool fixedSize ;
+		//! Rewrite the triple loop c[i,j] = c[i,j] + a[i,k] * b[k,j] into one
+		//! call of the blocked, vectorized Matrix::multiplyAdd.
+		bool blockedMatmul ;
+		//! Store read-only comprehensions of Int or Bool cells, only ever
+		//! indexed, in a TypedMatrix of int32_t, or of uint8_t when every
+		//! cell is Bool or a constant in 0 .. 255; their cells are read
+		//! back as float, so results do not change.
+		bool narrowTypes ;
+		//! Hold matrices declared as m = readMatrix(file), if they are
+		//! only ever indexed, as a QuantizedMatrix of 8- or 16-bit codes
+		//! into a table of their values.  Exact, so results do not change.
+		bool quantize ;
+		//! Compute comprehensions whose cells only read their own row of
+		//! other matrices, and assign only variables they declare, by a
+		//! kernel function run over blocks of rows by several threads.
+		bool rowKernels ;
+		//! Text form of the switches, e.g. for cache keys.
+		std::string signature ( ) ;
+} ;
+
+//ProgramFacts
+//! What Root::cppCode learns about the program before translating it.
+//! Until it has run (valid is false) every matrix counts as written.
+class ProgramFacts {
+	public:
+		ProgramFacts() : valid(false) { } ;
+		//! Gathers the facts for the program rooted at root.
+		void collect ( Node *root ) ;
+		//! True if the program never writes to name after declaring it.
+		bool readOnly ( const std::string &name ) ;
+		//! Declared type of name ("Int", "Float", "Matrix", "Matrix<Int>",
+		//! "Sparse", ...), or ""
+		//! if it is unknown or declared with different types.
+		std::string typeOf ( const std::string &name ) ;
+		//! True if name is read-only and only used as name[i, j],
+		//! numRows(name) or numCols(name).
+		bool onlyIndexed ( const std::string &name ) ;
+		//! False if name is only used as name[i, j], numRows(name) or numCols(name).
+		bool usedWhole ( const std::string &name ) ;
+		//! The value assigned to name if it is declared once and assigned
+		//! once, else NULL.
+		Expr *singleAssignment ( const std::string &name ) ;
+		//! Type of the value of e, as for typeOf, or "" if it is unknown.
+		std::string exprType ( Expr *e ) ;
+		bool valid ;
+		std::set<std::string> written ; //! targets of LongAssignStmt and AssignStmt
+		std::map<std::string, std::string> types ; //! declared types, "?" on conflicts
+		std::set<std::string> wholeUses ; //! variables used other than by onlyIndexed's forms
+		std::map<std::string, int> declarations ; //! number of declarations of each name
+		std::map<std::string, std::vector<Expr *> > assignments ; //! values assigned; NULL for loops
+		//! Matrices declared as some other type than Matrix, e.g. a
+		//! TriangularMatrix.  Filled in while translating, by the declarations.
+		std::set<std::string> specialized ;
+		//! Matrices stored with narrower cells by narrowTypes or quantize, a
+		//! subset of specialized, whose indexings are converted back to float.
+		std::set<std::string> narrowed ;
+		//! Matrices whose summed-area tables the translation looks up,
+		//! filled in by rectangularSum.  A parfor builds those of its body
+		//! before its threads start, since prefixSums builds them lazily.
+		std::set<std::string> summed ;
+		//! Type errors, such as a Str operand of an element-wise matrix
+		//! operator, as "line n: ..." messages.
+		std::vector<std::string> errors ;
+		//! The Float cell variables of the map, zip and filter bodies being
+		//! checked or translated, innermost last.  They shadow the variables
+		//! of the same name in typeOf and singleAssignment.
+		std::vector<std::string> cells ;
+		//! The cell variables bound by n, if it is a map, zip or filter.
+		static std::vector<std::string> cellVariables ( Node *n ) ;
+	private:
+		void declare ( const std::string &name, const std::string &type ) ;
+		bool bindsCell ( const std::string &name ) ;
+		void check ( Node *n ) ;
+		void checkNode ( Node *n ) ;
+		void checkCollection ( Node *n ) ;
+		void checkParfor ( Node *n ) ;
+		void checkIndices ( Node *n ) ;
+		void checkCube ( Node *n ) ;
+		void checkSparse ( Node *n ) ;
+		void checkCall ( Node *n ) ;
+		void checkTyped ( Node *n ) ;
+} ;
 
 //Node
 class Node {
@@ -29,20 +145,32 @@ class Node {
  	//! Virtual method in Node class for translating into C++
 		virtual std::string cppCode ( ) { return " This should be pure virtual" ; } ;
 		virtual ~Node() { };
+ 	//! Appends the direct sub-nodes of this node to kids, for analyses over the tree.
+		virtual void children ( std::vector<Node *> &kids ) { } ;
+	//! Options consulted by every cppCode method.
+		static CodeGenOptions options ;
+	//! Facts about the whole program, gathered by Root::cppCode.
+		static ProgramFacts facts ;
 } ;
 
 //Root
 class Root : public Node {
  public:
  //! Constructor for Root node.\param v varName \param s stmts
- Root(VarName *v, Stmts *s) : varName(v), stmts(s) { } ;
+ //! \param p the tile parameter, or NULL
+ Root(VarName *v, Stmts *s, VarName *p = NULL) : varName(v), stmts(s), param(p) { } ;
   std::string unparse (); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  //! The Str parameter of main ( tile ) { ... }, bound by runTiles to
+  //! each input tile in turn, or NULL.
+  VarName *parameter () { return param ; }
   virtual ~Root() ;
  private:
   VarName *varName ;//! VarName *varName
   Stmts *stmts ;
- Root() : varName(NULL), stmts(NULL) { } ;
+  VarName *param ;
+ Root() : varName(NULL), stmts(NULL), param(NULL) { } ;
   Root(const Root &) {};
 } ;
 
@@ -55,6 +183,7 @@ class DeclStmt: public Stmt {
  DeclStmt(Decl *_decl) : decl(_decl) {};
   std::string unparse (); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
  private:
   Decl *decl; //need to double check this -lee
   DeclStmt(const DeclStmt &) {};
@@ -66,6 +195,7 @@ class IfStmt:public Stmt {
   IfStmt(Expr *_ifExpr, Stmt *_thenStmt) : ifExpr(_ifExpr), thenStmt(_thenStmt) {};
   std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
  private:
   Expr *ifExpr;
   Stmt *thenStmt;
@@ -79,6 +209,7 @@ class IfElseStmt: public Stmt {
  IfElseStmt(Expr *_ifExpr, Stmt *_thenStmt, Stmt *_elseStmt) : ifExpr(_ifExpr), thenStmt(_thenStmt), elseStmt(_elseStmt) {};
    std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
  private:
    Expr *ifExpr;
    Stmt *thenStmt;
@@ -92,6 +223,8 @@ class BlockStmt: public Stmt {
  BlockStmt(Stmts *_statements) : statements(_statements) {};
   std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  Stmts *body () { return statements; }
  private:
   Stmts *statements;
   BlockStmt(const BlockStmt &){};
@@ -103,17 +236,34 @@ class PrintStmt: public Stmt {
  PrintStmt(Expr *_printExpr) : printExpr(_printExpr) {};
   std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
  private:
   Expr *printExpr;
   PrintStmt(const PrintStmt &){};
 } ;
 
+class CallStmt: public Stmt {
+ public:
+ //! Constructor for CallStmt node, a builtin called for its effect.
+ CallStmt(NestOrFuncExpr *_call) : call(_call) {};
+  std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  NestOrFuncExpr *callee () { return call; }
+ private:
+  NestOrFuncExpr *call;
+  CallStmt(const CallStmt &){};
+} ;
+
 class AssignStmt: public Stmt {
  public: 
  //! Constructor for AssignStmt node.
  AssignStmt(VarName *_var, Expr *_rightExpr) : var(_var), rightExpr(_rightExpr) {} ;
   std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *target () { return var; }
+  Expr *value () { return rightExpr; }
  private:
   VarName *var;
   Expr *rightExpr;
@@ -123,16 +273,26 @@ class AssignStmt: public Stmt {
 
 class LongAssignStmt: public Stmt {
  public: 
- //! Constructor for LongAssignStmt node.
- LongAssignStmt(VarName *_var, Expr* _leftExpr1, Expr* _leftExpr2, Expr* _rightExpr) :
-  var(_var), leftExpr1 (_leftExpr1), leftExpr2(_leftExpr2), rightExpr (_rightExpr) {};
+ //! Constructor for LongAssignStmt node. \param _line source line, for diagnostics
+ LongAssignStmt(VarName *_var, Expr* _leftExpr1, Expr* _leftExpr2, Expr* _rightExpr, int _line = 0, Expr *_leftExpr3 = NULL) :
+  var(_var), leftExpr1 (_leftExpr1), leftExpr2(_leftExpr2), leftExpr3(_leftExpr3), rightExpr (_rightExpr), line(_line) {};
   std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *matrix () { return var; }
+  Expr *rowIndex () { return leftExpr1; }
+  Expr *colIndex () { return leftExpr2; }
+  //! The third index, of a Cube, or NULL.
+  Expr *depthIndex () { return leftExpr3; }
+  Expr *value () { return rightExpr; }
+  int sourceLine () { return line; }
  private: 
   VarName *var;
   Expr *leftExpr1;
   Expr *leftExpr2;
+  Expr *leftExpr3;
   Expr *rightExpr;
+  int line;
   LongAssignStmt(const LongAssignStmt &){};
 } ;
 
@@ -142,6 +302,7 @@ class WhileStmt: public Stmt {
  WhileStmt(Expr* _whileExpr, Stmt* _whileStmt) : whileExpr(_whileExpr), whileStmt(_whileStmt){};
   std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
  private:
   Expr *whileExpr;
   Stmt *whileStmt;
@@ -155,14 +316,77 @@ class ForStmt: public Stmt {
  ForStmt(VarName* _varName, Expr* _expr1, Expr* _expr2, Stmt* _stmt): var(_varName), expr1 (_expr1), expr2(_expr2),statements (_stmt) {};
   std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var; }
  private:
   VarName *var;
   Expr *expr1;
   Expr *expr2;
   Stmt *statements;
+  std::string rectangularSum ();
+  std::string reduction ();
+  std::string matmulCode ();
   ForStmt(const ForStmt &){};
 } ;
 
+//! A for loop whose iterations are independent.  The loop variable,
+//! the Int, Float and Str variables the body assigns and each reduction
+//! variable are private to the iterations; each reduction combines its
+//! private values with op (+ * max min) into the variable after the loop.
+class ParforStmt: public Stmt {
+ public:
+ //! Constructor for ParforStmt node.
+ ParforStmt(VarName* _varName, Expr* _expr1, Expr* _expr2,
+            const std::vector<std::string> &_ops, const std::vector<VarName *> &_reduced,
+            Stmt* _stmt, int _line)
+   : var(_varName), expr1(_expr1), expr2(_expr2), ops(_ops), reduced(_reduced),
+     statements(_stmt), line(_line) {};
+  std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var; }
+  Stmt *body () { return statements; }
+  const std::vector<VarName *> &reductions () { return reduced; }
+  int sourceLine () { return line; }
+  //! Variables other than the reductions the body assigns as a whole.
+  std::set<std::string> assigned () ;
+ private:
+  VarName *var;
+  Expr *expr1;
+  Expr *expr2;
+  std::vector<std::string> ops;
+  std::vector<VarName *> reduced;
+  Stmt *statements;
+  int line;
+  ParforStmt(const ParforStmt &){};
+} ;
+
+//! 'for' '(' varName ',' varName ',' varName 'in' varName ')' Stmt: runs
+//! Stmt once for each stored cell of a Sparse matrix, row by row, with
+//! the Int row and column and the Float value of the cell assigned.
+class SparseForStmt: public Stmt {
+ public:
+ //! Constructor for SparseForStmt node. \param _line source line, for diagnostics
+ SparseForStmt(VarName* _row, VarName* _col, VarName* _value, VarName* _source, Stmt* _stmt, int _line)
+   : row(_row), col(_col), value(_value), source(_source), statements(_stmt), line(_line) {};
+  std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *rowVariable () { return row; }
+  VarName *colVariable () { return col; }
+  VarName *valueVariable () { return value; }
+  VarName *matrix () { return source; }
+  int sourceLine () { return line; }
+ private:
+  VarName *row;
+  VarName *col;
+  VarName *value;
+  VarName *source;
+  Stmt *statements;
+  int line;
+  SparseForStmt(const SparseForStmt &){};
+} ;
+
 //Stmts
 class Stmts : public Node {} ;
 
@@ -182,6 +406,9 @@ public:
     StmtsSeq( Stmt *_stmt, Stmts *_stmts) : stmt(_stmt), stmts(_stmts) { } ;
     std::string unparse ( );
 	std::string cppCode ();
+	void children (std::vector<Node *> &kids) ;
+	Stmt *first () { return stmt; }
+	Stmts *rest () { return stmts; }
 private:
     Stmt *stmt ;
     Stmts *stmts ;
@@ -199,6 +426,9 @@ public:
        SimpleDecl(std::string _kwd, VarName *_var) : kwd(_kwd), var(_var) {};
        std::string unparse(); 
 	   std::string cppCode ();
+	   void children (std::vector<Node *> &kids) ;
+	   std::string keyword () { return kwd; }
+	   VarName *variable () { return var; }
 private:
         std::string kwd;
         VarName *var;
@@ -211,7 +441,10 @@ public:
        MatrixDecl(VarName *_var1, Expr *_expr1) : var1(_var1), expr1(_expr1) {};
        std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var1; }
 private:
+        std::string quantizedCode ();
         VarName *var1;
         Expr *expr1;
         MatrixDecl (const MatrixDecl &) {} ;
@@ -219,20 +452,146 @@ private:
 
 class LongMatrixDecl : public Decl {
 public:
- //! Constructor for LongMatrixDecl node.
-       LongMatrixDecl(VarName *_var1, VarName *_var2, VarName *_var3, Expr *_expr1, Expr *_expr2, Expr *_expr3) : var1(_var1), var2(_var2), var3(_var3), expr1(_expr1), expr2(_expr2), expr3(_expr3) {};
+ //! Constructor for LongMatrixDecl node. \param _element the cell type,
+ //! Float for a plain Matrix, or Double, Int or Byte
+       LongMatrixDecl(VarName *_var1, VarName *_var2, VarName *_var3, Expr *_expr1, Expr *_expr2, Expr *_expr3, std::string _element = "Float", int _line = 0) : var1(_var1), var2(_var2), var3(_var3), expr1(_expr1), expr2(_expr2), expr3(_expr3), element(_element), line(_line) {};
        std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var1; }
+  VarName *rowVariable () { return var2; }
+  VarName *colVariable () { return var3; }
+  std::string elementType () { return element; }
+  Expr *cellExpr () { return expr3; }
+  int sourceLine () { return line; }
 private:
+        std::string triangularCode ();
+        std::string viewCode ();
+        std::string fixedCode ();
+        std::string narrowCode ();
+        std::string typedCode (const std::string &cell);
+        std::string rowKernelCode ();
         VarName *var1;
         VarName *var2;
         VarName *var3;
         Expr *expr1;
         Expr *expr2;
         Expr *expr3;
+        std::string element;
+        int line;
         LongMatrixDecl (const LongMatrixDecl &) {} ;
 } ;
 
+//! 'Mask' varName '=' Expr ';', a Mask set where Expr, a Mask or Matrix, is not 0.
+class MaskDecl : public Decl {
+public:
+ //! Constructor for MaskDecl node.
+       MaskDecl(VarName *_var1, Expr *_expr1) : var1(_var1), expr1(_expr1) {};
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var1; }
+private:
+        VarName *var1;
+        Expr *expr1;
+        MaskDecl (const MaskDecl &) {} ;
+} ;
+
+//! 'Mask' varName '[' Expr ',' Expr ']' varName ',' varName '=' Expr ';',
+//! the comprehension of a Mask whose cells are the truth of Expr.
+class LongMaskDecl : public Decl {
+public:
+ //! Constructor for LongMaskDecl node.
+       LongMaskDecl(VarName *_var1, VarName *_var2, VarName *_var3, Expr *_expr1, Expr *_expr2, Expr *_expr3) : var1(_var1), var2(_var2), var3(_var3), expr1(_expr1), expr2(_expr2), expr3(_expr3) {};
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var1; }
+  VarName *rowVariable () { return var2; }
+  VarName *colVariable () { return var3; }
+private:
+        VarName *var1;
+        VarName *var2;
+        VarName *var3;
+        Expr *expr1;
+        Expr *expr2;
+        Expr *expr3;
+        LongMaskDecl (const LongMaskDecl &) {} ;
+} ;
+
+//! 'Sparse' varName '[' Expr ',' Expr ']' varName ',' varName '=' Expr ';',
+//! the comprehension of a SparseMatrix, storing only its cells that are not 0.
+class LongSparseDecl : public Decl {
+public:
+ //! Constructor for LongSparseDecl node.
+       LongSparseDecl(VarName *_var1, VarName *_var2, VarName *_var3, Expr *_expr1, Expr *_expr2, Expr *_expr3) : var1(_var1), var2(_var2), var3(_var3), expr1(_expr1), expr2(_expr2), expr3(_expr3) {};
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var1; }
+  VarName *rowVariable () { return var2; }
+  VarName *colVariable () { return var3; }
+private:
+        VarName *var1;
+        VarName *var2;
+        VarName *var3;
+        Expr *expr1;
+        Expr *expr2;
+        Expr *expr3;
+        LongSparseDecl (const LongSparseDecl &) {} ;
+} ;
+
+//! 'Cube' ['<' Layout '>'] varName '[' Expr ',' Expr ',' Expr ']' varName ',' varName ',' varName '=' Expr ';',
+//! the comprehension of a three-dimensional Cube.
+class LongCubeDecl : public Decl {
+public:
+ //! Constructor for LongCubeDecl node. \param _indices the index variables
+ //! \param _extents the sizes along each axis
+ //! \param _layout LastFastest or FirstFastest, as in Cube::Layout
+       LongCubeDecl(VarName *_var, VarName *_indices[3], Expr *_extents[3], Expr *_cell,
+                    std::string _layout = "LastFastest") : var(_var), cell(_cell), layout(_layout) {
+         for (int axis = 0; axis < 3; axis ++) { indices[axis] = _indices[axis]; extents[axis] = _extents[axis]; }
+       };
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var; }
+  VarName *index ( int axis ) { return indices[axis]; }
+private:
+        VarName *var;
+        VarName *indices[3];
+        Expr *extents[3];
+        Expr *cell;
+        std::string layout;
+        LongCubeDecl (const LongCubeDecl &) {} ;
+} ;
+
+//! 'Cube' ['<' Layout '>'] varName '[' Expr ',' Expr ',' Expr ']' '=' Expr ';',
+//! the rows of the Matrix Expr read as a Cube, cell (i, j, k) being
+//! cell (i, j * d2 + k) of the matrix.
+class CubeDecl : public Decl {
+public:
+ //! Constructor for CubeDecl node. \param _extents the sizes along each axis
+ //! \param _layout LastFastest or FirstFastest, as in Cube::Layout
+       CubeDecl(VarName *_var, Expr *_extents[3], Expr *_source, std::string _layout, int _line)
+         : var(_var), source(_source), layout(_layout), line(_line) {
+         for (int axis = 0; axis < 3; axis ++) extents[axis] = _extents[axis];
+       };
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *variable () { return var; }
+  Expr *matrix () { return source; }
+  int sourceLine () { return line; }
+private:
+        VarName *var;
+        Expr *extents[3];
+        Expr *source;
+        std::string layout;
+        int line;
+        CubeDecl (const CubeDecl &) {} ;
+} ;
+
 //Expr
 class Expr : public Node {
 } ;
@@ -240,14 +599,20 @@ class Expr : public Node {
 class BinOpExpr : public Expr {
 public:
  //! Constructor for BinOpExpr node.
-    BinOpExpr( Expr *_left, std::string *_op, Expr *_right)
-    : left(_left), op(_op), right(_right) { } ;
+    BinOpExpr( Expr *_left, std::string *_op, Expr *_right, int _line = 0)
+    : left(_left), op(_op), right(_right), line(_line) { } ;
     std::string unparse ( ) ;
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+    Expr *leftOperand () { return left; }
+    std::string opName () { return *op; }
+    Expr *rightOperand () { return right; }
+    int sourceLine () { return line; }
 private:
     Expr *left ;
     std::string *op ;
     Expr *right ;
+    int line ; //! line of the operator, for diagnostics
     BinOpExpr(const BinOpExpr &) { } ;
 } ;
 
@@ -257,6 +622,7 @@ public:
     VarName(std::string _lexeme ) : lexeme(_lexeme) { } ;
     std::string unparse ( ) ;
   std::string cppCode ();
+    std::string name () { return lexeme; }
 private:
     std::string lexeme ;
     VarName ( ) : lexeme( (std::string) "") { } ;
@@ -269,6 +635,7 @@ public:
     AnyConst ( std::string _s ) : constString(_s) { } ;
     std::string unparse ( ) ;
   std::string cppCode ();
+  std::string text () { return constString; }
 private:
     std::string constString ;
     AnyConst() {};
@@ -278,12 +645,19 @@ private:
 class NestOrFuncExpr : public Expr {
 public:
  //! Constructor for NestOrFuncExpr node.
-       NestOrFuncExpr(VarName *_var, Expr *_expr) : var(_var), expr(_expr) {};
+       NestOrFuncExpr(VarName *_var, Expr *_expr, Expr *_expr2 = NULL, int _line = 0) : var(_var), expr(_expr), expr2(_expr2), line(_line) {};
        std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *function () { return var; }
+  Expr *argument () { return expr; }
+  Expr *secondArgument () { return expr2; }
+  int sourceLine () { return line; }
 private:
         VarName *var;
         Expr *expr;
+        Expr *expr2; //! NULL for one argument functions, such as numRows
+        int line;
         NestOrFuncExpr(const NestOrFuncExpr &) {};
 };
 
@@ -293,6 +667,8 @@ public:
     ParenExpr(Expr *_centerExpr) :expr(_centerExpr) {} ;
     std::string unparse ( ) ;
     std::string cppCode ();
+    void children (std::vector<Node *> &kids) ;
+    Expr *inner () { return expr; }
 private:
     Expr *expr;
     ParenExpr (const ParenExpr &) { } ;
@@ -300,14 +676,23 @@ private:
 
 class MatrixRefExpr : public Expr {
 public:
- //! Constructor for MatrixRefExpr node.
-       MatrixRefExpr(VarName *_var, Expr *_expr1, Expr *_expr2) : var(_var), expr1(_expr1), expr2(_expr2){};
+ //! Constructor for MatrixRefExpr node. \param _line source line, for diagnostics
+       MatrixRefExpr(VarName *_var, Expr *_expr1, Expr *_expr2, int _line = 0, Expr *_expr3 = NULL) : var(_var), expr1(_expr1), expr2(_expr2), expr3(_expr3), line(_line){};
        std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *matrix () { return var; }
+  Expr *rowIndex () { return expr1; }
+  Expr *colIndex () { return expr2; }
+  //! The third index, of a Cube, or NULL.
+  Expr *depthIndex () { return expr3; }
+  int sourceLine () { return line; }
 private:
         VarName *var;
         Expr *expr1;
         Expr *expr2;
+        Expr *expr3;
+        int line;
         MatrixRefExpr(const MatrixRefExpr &) {};
 };
 
@@ -317,6 +702,7 @@ public:
        LetExpr(Stmts *_stmts, Expr *_expr) : stmts(_stmts), expr(_expr) {};
        std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
 private:
         Stmts *stmts;
         Expr *expr;
@@ -329,6 +715,10 @@ public:
        IfElseExpr(Expr *_expr1, Expr *_expr2, Expr *_expr3) : expr1(_expr1), expr2(_expr2), expr3(_expr3) {};
        std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  Expr *condition () { return expr1; }
+  Expr *thenExpr () { return expr2; }
+  Expr *elseExpr () { return expr3; }
 private:
         Expr *expr1;
         Expr *expr2;
@@ -342,10 +732,101 @@ public:
        NotExpr(Expr *_expr) : expr(_expr) {};
        std::string unparse(); 
   std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  Expr *operand () { return expr; }
 private:
         Expr *expr;
         NotExpr(const NotExpr &) {};
 };
 
+//! map ( x in m , Expr ): the matrix of Expr for each cell x of m.
+class MapExpr : public Expr {
+public:
+ //! Constructor for MapExpr node. \param _line source line, for diagnostics
+       MapExpr(VarName *_var, Expr *_source, Expr *_body, int _line = 0) : var(_var), source(_source), body(_body), line(_line) {};
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *cell () { return var; }
+  Expr *matrix () { return source; }
+  Expr *value () { return body; }
+  int sourceLine () { return line; }
+private:
+        VarName *var;
+        Expr *source;
+        Expr *body;
+        int line;
+        MapExpr(const MapExpr &) {};
+};
+
+//! zip ( x in a , y in b , Expr ): the matrix of Expr for each pair of
+//! cells x of a and y of b at the same position.
+class ZipExpr : public Expr {
+public:
+ //! Constructor for ZipExpr node. \param _line source line, for diagnostics
+       ZipExpr(VarName *_var1, Expr *_source1, VarName *_var2, Expr *_source2, Expr *_body, int _line = 0)
+           : var1(_var1), source1(_source1), var2(_var2), source2(_source2), body(_body), line(_line) {};
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *firstCell () { return var1; }
+  Expr *firstMatrix () { return source1; }
+  VarName *secondCell () { return var2; }
+  Expr *secondMatrix () { return source2; }
+  Expr *value () { return body; }
+  int sourceLine () { return line; }
+private:
+        VarName *var1;
+        Expr *source1;
+        VarName *var2;
+        Expr *source2;
+        Expr *body;
+        int line;
+        ZipExpr(const ZipExpr &) {};
+};
+
+//! filter ( x in m , Expr ): the cells x of m for which Expr holds, in
+//! row-major order, as a column.
+class FilterExpr : public Expr {
+public:
+ //! Constructor for FilterExpr node. \param _line source line, for diagnostics
+       FilterExpr(VarName *_var, Expr *_source, Expr *_cond, int _line = 0) : var(_var), source(_source), cond(_cond), line(_line) {};
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  VarName *cell () { return var; }
+  Expr *matrix () { return source; }
+  Expr *condition () { return cond; }
+  int sourceLine () { return line; }
+private:
+        VarName *var;
+        Expr *source;
+        Expr *cond;
+        int line;
+        FilterExpr(const FilterExpr &) {};
+};
+
+//! fold ( op , Expr ) and fold ( op , Expr , rows | cols ): the cells of a
+//! matrix combined with op, one of + * max min, into one Float, or into
+//! one per row or per column.
+class FoldExpr : public Expr {
+public:
+ //! Constructor for FoldExpr node. \param _axis "", "rows" or "cols"
+       FoldExpr(std::string _op, Expr *_source, std::string _axis, int _line = 0) : op(_op), source(_source), axis(_axis), line(_line) {};
+       std::string unparse();
+  std::string cppCode ();
+  void children (std::vector<Node *> &kids) ;
+  std::string opName () { return op; }
+  Expr *matrix () { return source; }
+  std::string along () { return axis; }
+  int sourceLine () { return line; }
+private:
+        std::string op;
+        Expr *source;
+        std::string axis;
+        int line;
+        FoldExpr(const FoldExpr &) {};
+};
+
 #endif
 
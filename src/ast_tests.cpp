@@ -0,0 +1,165 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#define _CXXTEST_ABORT_TEST_ON_FAIL
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_AstTestSuite_init = false;
+#include "/root/repo/src/ast_tests.h"
+
+static AstTestSuite suite_AstTestSuite;
+
+static CxxTest::List Tests_AstTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AstTestSuite( "ast_tests.h", 12, "AstTestSuite", suite_AstTestSuite, Tests_AstTestSuite );
+
+static class TestDescription_suite_AstTestSuite_test_sample_1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_1() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 91, "test_sample_1" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_1(); }
+} testDescription_suite_AstTestSuite_test_sample_1;
+
+static class TestDescription_suite_AstTestSuite_test_sample_2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_2() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 95, "test_sample_2" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_2(); }
+} testDescription_suite_AstTestSuite_test_sample_2;
+
+static class TestDescription_suite_AstTestSuite_test_sample_3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_3() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 99, "test_sample_3" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_3(); }
+} testDescription_suite_AstTestSuite_test_sample_3;
+
+static class TestDescription_suite_AstTestSuite_test_sample_4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_4() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 103, "test_sample_4" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_4(); }
+} testDescription_suite_AstTestSuite_test_sample_4;
+
+static class TestDescription_suite_AstTestSuite_test_sample_5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_5() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 107, "test_sample_5" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_5(); }
+} testDescription_suite_AstTestSuite_test_sample_5;
+
+static class TestDescription_suite_AstTestSuite_test_mysample : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_mysample() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 111, "test_mysample" ) {}
+ void runTest() { suite_AstTestSuite.test_mysample(); }
+} testDescription_suite_AstTestSuite_test_mysample;
+
+static class TestDescription_suite_AstTestSuite_test_forest_loss : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_forest_loss() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 115, "test_forest_loss" ) {}
+ void runTest() { suite_AstTestSuite.test_forest_loss(); }
+} testDescription_suite_AstTestSuite_test_forest_loss;
+
+static class TestDescription_suite_AstTestSuite_test_sample_7 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_7() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 117, "test_sample_7" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_7(); }
+} testDescription_suite_AstTestSuite_test_sample_7;
+
+static class TestDescription_suite_AstTestSuite_test_sample_8 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sample_8() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 119, "test_sample_8" ) {}
+ void runTest() { suite_AstTestSuite.test_sample_8(); }
+} testDescription_suite_AstTestSuite_test_sample_8;
+
+static class TestDescription_suite_AstTestSuite_test_my_code_1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_my_code_1() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 120, "test_my_code_1" ) {}
+ void runTest() { suite_AstTestSuite.test_my_code_1(); }
+} testDescription_suite_AstTestSuite_test_my_code_1;
+
+static class TestDescription_suite_AstTestSuite_test_my_code_2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_my_code_2() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 121, "test_my_code_2" ) {}
+ void runTest() { suite_AstTestSuite.test_my_code_2(); }
+} testDescription_suite_AstTestSuite_test_my_code_2;
+
+static class TestDescription_suite_AstTestSuite_test_write_matrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_write_matrix() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 124, "test_write_matrix" ) {}
+ void runTest() { suite_AstTestSuite.test_write_matrix(); }
+} testDescription_suite_AstTestSuite_test_write_matrix;
+
+static class TestDescription_suite_AstTestSuite_test_collections : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_collections() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 127, "test_collections" ) {}
+ void runTest() { suite_AstTestSuite.test_collections(); }
+} testDescription_suite_AstTestSuite_test_collections;
+
+static class TestDescription_suite_AstTestSuite_test_parfor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_parfor() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 130, "test_parfor" ) {}
+ void runTest() { suite_AstTestSuite.test_parfor(); }
+} testDescription_suite_AstTestSuite_test_parfor;
+
+static class TestDescription_suite_AstTestSuite_test_bools : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_bools() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 133, "test_bools" ) {}
+ void runTest() { suite_AstTestSuite.test_bools(); }
+} testDescription_suite_AstTestSuite_test_bools;
+
+static class TestDescription_suite_AstTestSuite_test_mask : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_mask() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 136, "test_mask" ) {}
+ void runTest() { suite_AstTestSuite.test_mask(); }
+} testDescription_suite_AstTestSuite_test_mask;
+
+static class TestDescription_suite_AstTestSuite_test_cube : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_cube() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 137, "test_cube" ) {}
+ void runTest() { suite_AstTestSuite.test_cube(); }
+} testDescription_suite_AstTestSuite_test_cube;
+
+static class TestDescription_suite_AstTestSuite_test_sparse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_sparse() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 138, "test_sparse" ) {}
+ void runTest() { suite_AstTestSuite.test_sparse(); }
+} testDescription_suite_AstTestSuite_test_sparse;
+
+static class TestDescription_suite_AstTestSuite_test_typed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_typed() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 139, "test_typed" ) {}
+ void runTest() { suite_AstTestSuite.test_typed(); }
+} testDescription_suite_AstTestSuite_test_typed;
+
+static class TestDescription_suite_AstTestSuite_test_quantized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_quantized() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 140, "test_quantized" ) {}
+ void runTest() { suite_AstTestSuite.test_quantized(); }
+} testDescription_suite_AstTestSuite_test_quantized;
+
+static class TestDescription_suite_AstTestSuite_test_row_kernel : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_row_kernel() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 141, "test_row_kernel" ) {}
+ void runTest() { suite_AstTestSuite.test_row_kernel(); }
+} testDescription_suite_AstTestSuite_test_row_kernel;
+
+static class TestDescription_suite_AstTestSuite_test_tiles : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_AstTestSuite_test_tiles() : CxxTest::RealTestDescription( Tests_AstTestSuite, suiteDescription_AstTestSuite, 142, "test_tiles" ) {}
+ void runTest() { suite_AstTestSuite.test_tiles(); }
+} testDescription_suite_AstTestSuite_test_tiles;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
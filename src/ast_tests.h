@@ -119,6 +119,27 @@ public:
     void test_sample_8 (void) { unparse_tests ("sample_8.dsl");}
     void test_my_code_1 (void) {unparse_tests ("my_code_1.dsl");}
     void test_my_code_2 (void) {unparse_tests ("my_code_2.dsl");}
+
+    //! Builtins called as statements, such as writeMatrix.
+    void test_write_matrix (void) {unparse_tests ("write_matrix.dsl");}
+
+    //! map, filter, fold and zip, also nested.
+    void test_collections (void) {unparse_tests ("collections.dsl");}
+
+    //! parfor loops with reduce clauses.
+    void test_parfor (void) {unparse_tests ("parfor.dsl");}
+
+    //! Bool declarations and constants, && and ||.
+    void test_bools (void) {unparse_tests ("bools.dsl");}
+
+    //! Mask declarations, comprehensions and indexing.
+    void test_mask (void) {unparse_tests ("mask.dsl");}
+    void test_cube (void) {unparse_tests ("cube.dsl");}
+    void test_sparse (void) {unparse_tests ("sparse.dsl");}
+    void test_typed (void) {unparse_tests ("typed.dsl");}
+    void test_quantized (void) {unparse_tests ("quantized.dsl");}
+    void test_row_kernel (void) {unparse_tests ("row_kernel.dsl");}
+    void test_tiles (void) {unparse_tests ("tiles.dsl");}
 } ;
 
 
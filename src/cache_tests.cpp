@@ -0,0 +1,63 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#define _CXXTEST_ABORT_TEST_ON_FAIL
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_CacheTestSuite_init = false;
+#include "/root/repo/src/cache_tests.h"
+
+static CacheTestSuite suite_CacheTestSuite;
+
+static CxxTest::List Tests_CacheTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CacheTestSuite( "cache_tests.h", 12, "CacheTestSuite", suite_CacheTestSuite, Tests_CacheTestSuite );
+
+static class TestDescription_suite_CacheTestSuite_test_keys : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheTestSuite_test_keys() : CxxTest::RealTestDescription( Tests_CacheTestSuite, suiteDescription_CacheTestSuite, 28, "test_keys" ) {}
+ void runTest() { suite_CacheTestSuite.test_keys(); }
+} testDescription_suite_CacheTestSuite_test_keys;
+
+static class TestDescription_suite_CacheTestSuite_test_translator_key : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheTestSuite_test_translator_key() : CxxTest::RealTestDescription( Tests_CacheTestSuite, suiteDescription_CacheTestSuite, 36, "test_translator_key" ) {}
+ void runTest() { suite_CacheTestSuite.test_translator_key(); }
+} testDescription_suite_CacheTestSuite_test_translator_key;
+
+static class TestDescription_suite_CacheTestSuite_test_store_and_fetch : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheTestSuite_test_store_and_fetch() : CxxTest::RealTestDescription( Tests_CacheTestSuite, suiteDescription_CacheTestSuite, 46, "test_store_and_fetch" ) {}
+ void runTest() { suite_CacheTestSuite.test_store_and_fetch(); }
+} testDescription_suite_CacheTestSuite_test_store_and_fetch;
+
+static class TestDescription_suite_CacheTestSuite_test_eviction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheTestSuite_test_eviction() : CxxTest::RealTestDescription( Tests_CacheTestSuite, suiteDescription_CacheTestSuite, 61, "test_eviction" ) {}
+ void runTest() { suite_CacheTestSuite.test_eviction(); }
+} testDescription_suite_CacheTestSuite_test_eviction;
+
+static class TestDescription_suite_CacheTestSuite_test_translator_hits : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CacheTestSuite_test_translator_hits() : CxxTest::RealTestDescription( Tests_CacheTestSuite, suiteDescription_CacheTestSuite, 76, "test_translator_hits" ) {}
+ void runTest() { suite_CacheTestSuite.test_translator_hits(); }
+} testDescription_suite_CacheTestSuite_test_translator_hits;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
@@ -0,0 +1,98 @@
+#include <cxxtest/TestSuite.h>
+#include <iostream>
+#include "translator.h"
+#include "translationCache.h"
+
+#include <stdlib.h>
+#include <string>
+#include <fstream>
+
+using namespace std ;
+
+class CacheTestSuite : public CxxTest::TestSuite
+{
+public:
+
+    string cacheDir ;
+
+    void setUp ( ) {
+        cacheDir = "../samples/.fcal_cache_test" ;
+        system ( ("rm -rf " + cacheDir).c_str() ) ;
+    }
+
+    void tearDown ( ) {
+        system ( ("rm -rf " + cacheDir).c_str() ) ;
+    }
+
+    //! Keys change with the source and with the options, but not otherwise.
+    void test_keys ( ) {
+        TranslationCache c ( cacheDir, 1 << 20, "../samples" ) ;
+        TS_ASSERT_EQUALS ( c.cppKey ("main(){}", ""), c.cppKey ("main(){}", "") ) ;
+        TS_ASSERT_DIFFERS ( c.cppKey ("main(){}", ""), c.cppKey ("main(){ }", "") ) ;
+        TS_ASSERT_DIFFERS ( c.cppKey ("main(){}", ""), c.cppKey ("main(){}", "-x") ) ;
+    }
+
+    //! A different translator does not reuse the entries of this one.
+    void test_translator_key ( ) {
+        TranslationCache c ( cacheDir, 1 << 20, "../samples" ) ;
+        TranslationCache rebuilt ( cacheDir, 1 << 20, "../samples" ) ;
+        TS_ASSERT ( ! c.translatorHash.empty() ) ;
+        TS_ASSERT_EQUALS ( c.cppKey ("main(){}", ""), rebuilt.cppKey ("main(){}", "") ) ;
+        rebuilt.translatorHash = "another build" ;
+        TS_ASSERT_DIFFERS ( c.cppKey ("main(){}", ""), rebuilt.cppKey ("main(){}", "") ) ;
+        TS_ASSERT_DIFFERS ( c.binaryKey ("int main(){}", "g++"), rebuilt.binaryKey ("int main(){}", "g++") ) ;
+    }
+
+    void test_store_and_fetch ( ) {
+        TranslationCache c ( cacheDir, 1 << 20, "../samples" ) ;
+        string cpp ;
+        TS_ASSERT ( ! c.fetchCpp ( "k1", cpp ) ) ;
+        c.storeCpp ( "k1", "int main () { }" ) ;
+        TS_ASSERT ( c.fetchCpp ( "k1", cpp ) ) ;
+        TS_ASSERT_EQUALS ( cpp, "int main () { }" ) ;
+        TS_ASSERT_EQUALS ( c.cppHits, 1 ) ;
+        TS_ASSERT_EQUALS ( c.cppMisses, 1 ) ;
+        // The temporary file it was written through is gone.
+        TS_ASSERT_EQUALS ( c.size(), 15 ) ;
+        TS_ASSERT_EQUALS ( system ( ("test `ls " + cacheDir + " | wc -l` = 1").c_str() ), 0 ) ;
+    }
+
+    //! The least recently used entry goes first when over the bound.
+    void test_eviction ( ) {
+        TranslationCache c ( cacheDir, 250, "../samples" ) ;
+        string entry ( 100, 'x' ), cpp ;
+        c.storeCpp ( "old", entry ) ;
+        c.storeCpp ( "mid", entry ) ;
+        TS_ASSERT ( c.fetchCpp ( "old", cpp ) ) ;
+        c.storeCpp ( "new", entry ) ;
+        TS_ASSERT_EQUALS ( c.evictions, 1 ) ;
+        TS_ASSERT ( c.size() <= 250 ) ;
+        TS_ASSERT ( c.fetchCpp ( "old", cpp ) ) ;
+        TS_ASSERT ( ! c.fetchCpp ( "mid", cpp ) ) ;
+        TS_ASSERT ( c.fetchCpp ( "new", cpp ) ) ;
+    }
+
+    //! A second translation and compile of an unchanged program are cache hits.
+    void test_translator_hits ( ) {
+        Translator t ;
+        t.useCache ( cacheDir, 64 << 20 ) ;
+        string cpp1, cpp2 ;
+        TS_ASSERT ( t.translate ( "../samples/sample_4.dsl", cpp1 ) ) ;
+        TS_ASSERT ( t.translate ( "../samples/sample_4.dsl", cpp2 ) ) ;
+        TS_ASSERT_EQUALS ( cpp1, cpp2 ) ;
+        TS_ASSERT_EQUALS ( t.cache->cppHits, 1 ) ;
+        TS_ASSERT_EQUALS ( t.cache->cppMisses, 1 ) ;
+
+        string cppfile = cacheDir + "/../sample_4_cached.cpp" ;
+        string exe = cacheDir + "/../sample_4_cached" ;
+        ofstream out ( cppfile.c_str() ) ;
+        out << cpp1 << endl ;
+        out.close () ;
+        TS_ASSERT_EQUALS ( t.compile ( cppfile, exe ), 0 ) ;
+        system ( ("rm -f " + exe).c_str() ) ;
+        TS_ASSERT_EQUALS ( t.compile ( cppfile, exe ), 0 ) ;
+        TS_ASSERT_EQUALS ( t.cache->binaryHits, 1 ) ;
+        TS_ASSERT_EQUALS ( system ( (exe + " > /dev/null").c_str() ), 0 ) ;
+        system ( ("rm -f " + exe + " " + cppfile).c_str() ) ;
+    }
+} ;
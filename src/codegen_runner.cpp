@@ -0,0 +1,259 @@
+/*! \file codegen_runner.cpp
+    \brief Parallel version of the code generation tests.
+
+    Translates every sample, then fans the compile, run and diff steps
+    out over at most -j child processes, and reports how long each step
+    took for each sample so that slow translations stand out.
+
+    Usage: codegen_runner [-j jobs] [sample ...]
+
+    With no samples, every sample and option variant that
+    codegeneration_tests.h passes to codegen_tests is run, as listed in
+    variants below; keep the two in step.  A variant with options writes
+    its files under the sample name followed by its switches, such as
+    rect_sum.prefix-sums.cpp, so that variants of one sample can run at
+    the same time.  The exit status is 0 only when every sample passes.
+*/
+
+#include "translator.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std ;
+
+//! Step of the pipeline a sample failed in, reported as the child's exit code.
+enum sampleResult { passed, failedTranslate, failedCompile, failedRun, failedDiff } ;
+
+static const char *resultNames[] = {
+    "ok", "translate failed", "compile failed", "run failed", "wrong output"
+} ;
+
+//! A sample and the switches to translate it with, ending at the first NULL.
+struct Variant {
+    const char *name ;
+    bool CodeGenOptions::*flags[6] ;
+} ;
+
+typedef CodeGenOptions O ;
+
+//! The codegen_tests cases of codegeneration_tests.h.
+static const Variant variants[] = {
+    { "sample_4", { } }, { "sample_5", { } }, { "sample_6", { } },
+    { "sample_7", { } }, { "sample_8", { } },
+    { "my_code_1", { } }, { "my_code_2", { } }, { "forest_loss_v2", { } },
+    { "sample_7", { &O::inlineAccess } }, { "my_code_1", { &O::inlineAccess } },
+    { "sample_7", { &O::boundsCheck } }, { "my_code_1", { &O::boundsCheck } },
+    { "rect_sum", { } }, { "rect_sum", { &O::prefixSums } }, { "my_code_1", { &O::prefixSums } },
+    { "row_reductions", { } }, { "row_reductions", { &O::vectorReductions } },
+    { "sample_7", { &O::vectorReductions } },
+    { "triangular", { } }, { "triangular", { &O::triangular } },
+    { "triangular", { &O::triangular, &O::prefixSums, &O::vectorReductions } },
+    { "reshape", { } }, { "reshape", { &O::views } },
+    { "reshape", { &O::views, &O::vectorReductions } },
+    { "fixed_size", { } }, { "fixed_size", { &O::fixedSize } }, { "sample_7", { &O::fixedSize } },
+    { "matmul", { } }, { "matmul", { &O::blockedMatmul } }, { "my_code_1", { &O::blockedMatmul } },
+    { "elementwise", { } },
+    { "elementwise", { &O::views, &O::fixedSize, &O::triangular, &O::prefixSums,
+                       &O::vectorReductions } },
+    { "bools", { } },
+    { "mask", { } }, { "mask", { &O::boundsCheck } }, { "mask", { &O::inlineAccess } },
+    { "cube", { } }, { "cube", { &O::boundsCheck } },
+    { "sparse", { } }, { "sparse", { &O::boundsCheck } },
+    { "typed", { } }, { "typed", { &O::narrowTypes } }, { "sample_7", { &O::narrowTypes } },
+    { "quantized", { } }, { "quantized", { &O::quantize } },
+    { "my_code_1", { &O::quantize } }, { "sample_8", { &O::quantize } },
+    { "row_kernel", { } }, { "row_kernel", { &O::rowKernels } },
+    { "print_formats", { } }, { "write_matrix", { } },
+    { "collections", { } }, { "collections", { &O::fixedSize } },
+    { "parfor", { } },
+    { "parfor", { &O::views, &O::fixedSize, &O::triangular, &O::prefixSums,
+                  &O::vectorReductions, &O::blockedMatmul } },
+    { "parfor_sums", { &O::prefixSums } },
+} ;
+
+//! Per sample bookkeeping.
+struct Sample {
+    string name ;
+    CodeGenOptions options ;
+    string file ;          //! name with the switches of options, for the output files
+    pid_t pid ;
+    int resultPipe ;       //! read end, the child writes its step timings here
+    double translateMs, compileMs, runMs, totalMs ;
+    double started ;
+    int result ;
+} ;
+
+//! Wall clock time in milliseconds.
+static double nowMs () {
+    struct timeval tv ;
+    gettimeofday (&tv, NULL) ;
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0 ;
+}
+
+//! Compiles, runs and diffs one translated sample against expected;
+//! runs in a child process.
+static int compileAndRun (Translator &t, const string &base, const string &expected, int out) {
+    string cppfile = base + ".cpp" ;
+    string cppout = base + ".output" ;
+
+    double start = nowMs () ;
+    int rc = t.compile (cppfile, base) ;
+    double compileMs = nowMs () - start ;
+    double runMs = 0 ;
+    int result = passed ;
+
+    if (rc != 0) {
+        result = failedCompile ;
+    } else {
+        start = nowMs () ;
+        rc = system ((base + " > " + cppout).c_str()) ;
+        runMs = nowMs () - start ;
+        if (rc != 0)
+            result = failedRun ;
+        else if (system (("diff " + cppout + " " + expected + " > " +
+                          base + ".diff").c_str()) != 0)
+            result = failedDiff ;
+    }
+
+    char buf[64] ;
+    int n = snprintf (buf, sizeof(buf), "%f %f\n", compileMs, runMs) ;
+    if (write (out, buf, n) != n) perror ("codegen_runner") ;
+    return result ;
+}
+
+//! Waits for any running child and records its result.
+//! \return false if there is no child to wait for.
+static bool reapOne (vector<Sample> &samples) {
+    int status ;
+    pid_t pid ;
+    do pid = wait (&status) ; while (pid < 0 && errno == EINTR) ;
+    if (pid < 0) {
+        perror ("codegen_runner") ;
+        return false ;
+    }
+    for (size_t i = 0; i < samples.size(); i ++) {
+        Sample &s = samples[i] ;
+        if (s.pid != pid) continue ;
+        s.totalMs = s.translateMs + nowMs () - s.started ;
+        s.result = WIFEXITED (status) ? WEXITSTATUS (status) : failedRun ;
+        if (s.result > failedDiff) s.result = failedRun ;
+        char buf[64] = "" ;
+        ssize_t n = read (s.resultPipe, buf, sizeof(buf) - 1) ;
+        if (n > 0) {
+            buf[n] = '\0' ;
+            sscanf (buf, "%lf %lf", &s.compileMs, &s.runMs) ;
+        }
+        close (s.resultPipe) ;
+        s.pid = 0 ;
+    }
+    return true ;
+}
+
+int main (int argc, char **argv) {
+    long jobs = sysconf (_SC_NPROCESSORS_ONLN) ;
+    vector<Sample> samples ;
+
+    for (int i = 1; i < argc; i ++) {
+        string arg (argv[i]) ;
+        if (arg == "-j" && i + 1 < argc) jobs = atol (argv[++i]) ;
+        else {
+            Sample s ;
+            s.name = arg ;
+            samples.push_back (s) ;
+        }
+    }
+    if (jobs < 1) jobs = 1 ;
+    if (samples.empty()) {
+        for (size_t i = 0; i < sizeof(variants) / sizeof(variants[0]); i ++) {
+            Sample s ;
+            s.name = variants[i].name ;
+            for (int f = 0; f < 6 && variants[i].flags[f]; f ++)
+                s.options.*variants[i].flags[f] = true ;
+            samples.push_back (s) ;
+        }
+    }
+    for (size_t i = 0; i < samples.size(); i ++) {
+        Sample &s = samples[i] ;
+        s.pid = 0 ;
+        s.translateMs = s.compileMs = s.runMs = s.totalMs = 0 ;
+        s.result = failedRun ;
+        s.file = s.name ;
+        string flags = s.options.signature () ;
+        for (size_t at = flags.find (" --"); at != string::npos; at = flags.find (" --", at))
+            flags.replace (at, 3, ".") ;
+        s.file += flags ;
+    }
+
+    Translator t ;
+    // Before forking, so that the children do not all rebuild the one library.
+    t.refreshLibrary () ;
+    double wallStart = nowMs () ;
+    int running = 0 ;
+
+    for (size_t i = 0; i < samples.size(); i ++) {
+        Sample &s = samples[i] ;
+        string base = t.runtimeDir + "/" + s.file ;
+        string source = t.runtimeDir + "/" + s.name ;
+
+        // Translation is cheap and reuses one parser, so it stays in this process.
+        double start = nowMs () ;
+        string cpp ;
+        t.options = s.options ;
+        bool ok = t.translate (source + ".dsl", cpp) ;
+        if (ok) {
+            ofstream out ((base + ".cpp").c_str()) ;
+            out << cpp << endl ;
+        }
+        s.translateMs = nowMs () - start ;
+        if (!ok) {
+            s.result = failedTranslate ;
+            s.totalMs = s.translateMs ;
+            cerr << s.name << ": " << t.errors << endl ;
+            continue ;
+        }
+
+        while (running >= jobs && reapOne (samples))
+            running -- ;
+        if (running >= jobs) break ;
+
+        int fds[2] ;
+        if (pipe (fds) != 0) { perror ("codegen_runner") ; return 1 ; }
+        s.started = nowMs () ;
+        pid_t pid = fork () ;
+        if (pid == 0) {
+            close (fds[0]) ;
+            _exit (compileAndRun (t, base, source + ".expected", fds[1])) ;
+        }
+        close (fds[1]) ;
+        s.pid = pid ;
+        s.resultPipe = fds[0] ;
+        running ++ ;
+    }
+    while (running > 0 && reapOne (samples))
+        running -- ;
+
+    int failures = 0 ;
+    printf ("%-18s %12s %12s %12s %12s  %s\n",
+            "sample", "translate", "compile", "run", "total", "result") ;
+    for (size_t i = 0; i < samples.size(); i ++) {
+        Sample &s = samples[i] ;
+        printf ("%-18s %9.1f ms %9.1f ms %9.1f ms %9.1f ms  %s\n",
+                s.file.c_str(), s.translateMs, s.compileMs, s.runMs, s.totalMs,
+                resultNames[s.result]) ;
+        if (s.result != passed) failures ++ ;
+    }
+    printf ("%d samples, %d failed, %.2f s wall with -j %ld\n",
+            (int) samples.size(), failures, (nowMs () - wallStart) / 1000.0, jobs) ;
+
+    return failures == 0 ? 0 : 1 ;
+}
@@ -0,0 +1,463 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_CodeGenTestSuite_init = false;
+#include "/root/repo/src/codegeneration_tests.h"
+
+static CodeGenTestSuite suite_CodeGenTestSuite;
+
+static CxxTest::List Tests_CodeGenTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CodeGenTestSuite( "codegeneration_tests.h", 13, "CodeGenTestSuite", suite_CodeGenTestSuite, Tests_CodeGenTestSuite );
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_4() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 101, "test_sample_4" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_4(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_4;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_5() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 102, "test_sample_5" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_5(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_5;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_6() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 103, "test_sample_6" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_6(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_6;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_7 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_7() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 104, "test_sample_7" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_7(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_7;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_8 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_8() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 105, "test_sample_8" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_8(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_8;
+
+static class TestDescription_suite_CodeGenTestSuite_test_stale_library : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_stale_library() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 109, "test_stale_library" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_stale_library(); }
+} testDescription_suite_CodeGenTestSuite_test_stale_library;
+
+static class TestDescription_suite_CodeGenTestSuite_test_my_code_1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_my_code_1() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 131, "test_my_code_1" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_my_code_1(); }
+} testDescription_suite_CodeGenTestSuite_test_my_code_1;
+
+static class TestDescription_suite_CodeGenTestSuite_test_my_code_2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_my_code_2() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 132, "test_my_code_2" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_my_code_2(); }
+} testDescription_suite_CodeGenTestSuite_test_my_code_2;
+
+static class TestDescription_suite_CodeGenTestSuite_test_forest_loss : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_forest_loss() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 134, "test_forest_loss" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_forest_loss(); }
+} testDescription_suite_CodeGenTestSuite_test_forest_loss;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_7_inline_access : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_7_inline_access() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 144, "test_sample_7_inline_access" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_7_inline_access(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_7_inline_access;
+
+static class TestDescription_suite_CodeGenTestSuite_test_my_code_1_inline_access : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_my_code_1_inline_access() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 145, "test_my_code_1_inline_access" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_my_code_1_inline_access(); }
+} testDescription_suite_CodeGenTestSuite_test_my_code_1_inline_access;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_7_bounds_check : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_7_bounds_check() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 148, "test_sample_7_bounds_check" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_7_bounds_check(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_7_bounds_check;
+
+static class TestDescription_suite_CodeGenTestSuite_test_my_code_1_bounds_check : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_my_code_1_bounds_check() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 149, "test_my_code_1_bounds_check" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_my_code_1_bounds_check(); }
+} testDescription_suite_CodeGenTestSuite_test_my_code_1_bounds_check;
+
+static class TestDescription_suite_CodeGenTestSuite_test_rect_sum : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_rect_sum() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 153, "test_rect_sum" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_rect_sum(); }
+} testDescription_suite_CodeGenTestSuite_test_rect_sum;
+
+static class TestDescription_suite_CodeGenTestSuite_test_rect_sum_prefix_sums : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_rect_sum_prefix_sums() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 154, "test_rect_sum_prefix_sums" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_rect_sum_prefix_sums(); }
+} testDescription_suite_CodeGenTestSuite_test_rect_sum_prefix_sums;
+
+static class TestDescription_suite_CodeGenTestSuite_test_my_code_1_prefix_sums : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_my_code_1_prefix_sums() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 159, "test_my_code_1_prefix_sums" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_my_code_1_prefix_sums(); }
+} testDescription_suite_CodeGenTestSuite_test_my_code_1_prefix_sums;
+
+static class TestDescription_suite_CodeGenTestSuite_test_row_reductions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_row_reductions() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 162, "test_row_reductions" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_row_reductions(); }
+} testDescription_suite_CodeGenTestSuite_test_row_reductions;
+
+static class TestDescription_suite_CodeGenTestSuite_test_row_reductions_vectorized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_row_reductions_vectorized() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 163, "test_row_reductions_vectorized" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_row_reductions_vectorized(); }
+} testDescription_suite_CodeGenTestSuite_test_row_reductions_vectorized;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_7_vectorized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_7_vectorized() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 170, "test_sample_7_vectorized" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_7_vectorized(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_7_vectorized;
+
+static class TestDescription_suite_CodeGenTestSuite_test_triangular : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_triangular() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 174, "test_triangular" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_triangular(); }
+} testDescription_suite_CodeGenTestSuite_test_triangular;
+
+static class TestDescription_suite_CodeGenTestSuite_test_triangular_packed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_triangular_packed() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 175, "test_triangular_packed" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_triangular_packed(); }
+} testDescription_suite_CodeGenTestSuite_test_triangular_packed;
+
+static class TestDescription_suite_CodeGenTestSuite_test_triangular_packed_rewrites : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_triangular_packed_rewrites() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 182, "test_triangular_packed_rewrites" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_triangular_packed_rewrites(); }
+} testDescription_suite_CodeGenTestSuite_test_triangular_packed_rewrites;
+
+static class TestDescription_suite_CodeGenTestSuite_test_reshape : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_reshape() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 190, "test_reshape" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_reshape(); }
+} testDescription_suite_CodeGenTestSuite_test_reshape;
+
+static class TestDescription_suite_CodeGenTestSuite_test_reshape_views : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_reshape_views() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 191, "test_reshape_views" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_reshape_views(); }
+} testDescription_suite_CodeGenTestSuite_test_reshape_views;
+
+static class TestDescription_suite_CodeGenTestSuite_test_reshape_views_reductions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_reshape_views_reductions() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 199, "test_reshape_views_reductions" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_reshape_views_reductions(); }
+} testDescription_suite_CodeGenTestSuite_test_reshape_views_reductions;
+
+static class TestDescription_suite_CodeGenTestSuite_test_fixed_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_fixed_size() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 206, "test_fixed_size" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_fixed_size(); }
+} testDescription_suite_CodeGenTestSuite_test_fixed_size;
+
+static class TestDescription_suite_CodeGenTestSuite_test_fixed_size_stack : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_fixed_size_stack() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 207, "test_fixed_size_stack" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_fixed_size_stack(); }
+} testDescription_suite_CodeGenTestSuite_test_fixed_size_stack;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_7_fixed_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_7_fixed_size() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 214, "test_sample_7_fixed_size" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_7_fixed_size(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_7_fixed_size;
+
+static class TestDescription_suite_CodeGenTestSuite_test_matmul : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_matmul() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 218, "test_matmul" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_matmul(); }
+} testDescription_suite_CodeGenTestSuite_test_matmul;
+
+static class TestDescription_suite_CodeGenTestSuite_test_matmul_blocked : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_matmul_blocked() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 219, "test_matmul_blocked" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_matmul_blocked(); }
+} testDescription_suite_CodeGenTestSuite_test_matmul_blocked;
+
+static class TestDescription_suite_CodeGenTestSuite_test_my_code_1_blocked_matmul : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_my_code_1_blocked_matmul() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 225, "test_my_code_1_blocked_matmul" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_my_code_1_blocked_matmul(); }
+} testDescription_suite_CodeGenTestSuite_test_my_code_1_blocked_matmul;
+
+static class TestDescription_suite_CodeGenTestSuite_test_elementwise : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_elementwise() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 229, "test_elementwise" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_elementwise(); }
+} testDescription_suite_CodeGenTestSuite_test_elementwise;
+
+static class TestDescription_suite_CodeGenTestSuite_test_elementwise_rewrites : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_elementwise_rewrites() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 230, "test_elementwise_rewrites" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_elementwise_rewrites(); }
+} testDescription_suite_CodeGenTestSuite_test_elementwise_rewrites;
+
+static class TestDescription_suite_CodeGenTestSuite_test_bools : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_bools() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 238, "test_bools" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_bools(); }
+} testDescription_suite_CodeGenTestSuite_test_bools;
+
+static class TestDescription_suite_CodeGenTestSuite_test_mask : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_mask() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 242, "test_mask" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_mask(); }
+} testDescription_suite_CodeGenTestSuite_test_mask;
+
+static class TestDescription_suite_CodeGenTestSuite_test_mask_bounds_check : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_mask_bounds_check() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 243, "test_mask_bounds_check" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_mask_bounds_check(); }
+} testDescription_suite_CodeGenTestSuite_test_mask_bounds_check;
+
+static class TestDescription_suite_CodeGenTestSuite_test_mask_inline_access : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_mask_inline_access() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 244, "test_mask_inline_access" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_mask_inline_access(); }
+} testDescription_suite_CodeGenTestSuite_test_mask_inline_access;
+
+static class TestDescription_suite_CodeGenTestSuite_test_mask_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_mask_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 247, "test_mask_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_mask_error(); }
+} testDescription_suite_CodeGenTestSuite_test_mask_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_cube : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_cube() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 254, "test_cube" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_cube(); }
+} testDescription_suite_CodeGenTestSuite_test_cube;
+
+static class TestDescription_suite_CodeGenTestSuite_test_cube_bounds_check : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_cube_bounds_check() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 255, "test_cube_bounds_check" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_cube_bounds_check(); }
+} testDescription_suite_CodeGenTestSuite_test_cube_bounds_check;
+
+static class TestDescription_suite_CodeGenTestSuite_test_cube_view : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_cube_view() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 259, "test_cube_view" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_cube_view(); }
+} testDescription_suite_CodeGenTestSuite_test_cube_view;
+
+static class TestDescription_suite_CodeGenTestSuite_test_cube_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_cube_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 271, "test_cube_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_cube_error(); }
+} testDescription_suite_CodeGenTestSuite_test_cube_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sparse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sparse() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 281, "test_sparse" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sparse(); }
+} testDescription_suite_CodeGenTestSuite_test_sparse;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sparse_bounds_check : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sparse_bounds_check() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 282, "test_sparse_bounds_check" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sparse_bounds_check(); }
+} testDescription_suite_CodeGenTestSuite_test_sparse_bounds_check;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sparse_guard : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sparse_guard() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 285, "test_sparse_guard" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sparse_guard(); }
+} testDescription_suite_CodeGenTestSuite_test_sparse_guard;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sparse_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sparse_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 293, "test_sparse_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sparse_error(); }
+} testDescription_suite_CodeGenTestSuite_test_sparse_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_typed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_typed() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 304, "test_typed" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_typed(); }
+} testDescription_suite_CodeGenTestSuite_test_typed;
+
+static class TestDescription_suite_CodeGenTestSuite_test_typed_narrow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_typed_narrow() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 305, "test_typed_narrow" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_typed_narrow(); }
+} testDescription_suite_CodeGenTestSuite_test_typed_narrow;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_7_narrow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_7_narrow() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 313, "test_sample_7_narrow" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_7_narrow(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_7_narrow;
+
+static class TestDescription_suite_CodeGenTestSuite_test_quantized : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_quantized() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 316, "test_quantized" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_quantized(); }
+} testDescription_suite_CodeGenTestSuite_test_quantized;
+
+static class TestDescription_suite_CodeGenTestSuite_test_quantized_codes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_quantized_codes() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 317, "test_quantized_codes" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_quantized_codes(); }
+} testDescription_suite_CodeGenTestSuite_test_quantized_codes;
+
+static class TestDescription_suite_CodeGenTestSuite_test_my_code_1_quantize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_my_code_1_quantize() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 323, "test_my_code_1_quantize" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_my_code_1_quantize(); }
+} testDescription_suite_CodeGenTestSuite_test_my_code_1_quantize;
+
+static class TestDescription_suite_CodeGenTestSuite_test_sample_8_quantize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_sample_8_quantize() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 325, "test_sample_8_quantize" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_sample_8_quantize(); }
+} testDescription_suite_CodeGenTestSuite_test_sample_8_quantize;
+
+static class TestDescription_suite_CodeGenTestSuite_test_row_kernel : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_row_kernel() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 334, "test_row_kernel" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_row_kernel(); }
+} testDescription_suite_CodeGenTestSuite_test_row_kernel;
+
+static class TestDescription_suite_CodeGenTestSuite_test_row_kernel_threads : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_row_kernel_threads() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 335, "test_row_kernel_threads" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_row_kernel_threads(); }
+} testDescription_suite_CodeGenTestSuite_test_row_kernel_threads;
+
+static class TestDescription_suite_CodeGenTestSuite_test_tiles : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_tiles() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 361, "test_tiles" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_tiles(); }
+} testDescription_suite_CodeGenTestSuite_test_tiles;
+
+static class TestDescription_suite_CodeGenTestSuite_test_tiles_failure : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_tiles_failure() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 371, "test_tiles_failure" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_tiles_failure(); }
+} testDescription_suite_CodeGenTestSuite_test_tiles_failure;
+
+static class TestDescription_suite_CodeGenTestSuite_test_arity_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_arity_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 384, "test_arity_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_arity_error(); }
+} testDescription_suite_CodeGenTestSuite_test_arity_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_typed_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_typed_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 395, "test_typed_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_typed_error(); }
+} testDescription_suite_CodeGenTestSuite_test_typed_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_elementwise_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_elementwise_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 407, "test_elementwise_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_elementwise_error(); }
+} testDescription_suite_CodeGenTestSuite_test_elementwise_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_print_formats : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_print_formats() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 417, "test_print_formats" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_print_formats(); }
+} testDescription_suite_CodeGenTestSuite_test_print_formats;
+
+static class TestDescription_suite_CodeGenTestSuite_test_write_matrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_write_matrix() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 432, "test_write_matrix" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_write_matrix(); }
+} testDescription_suite_CodeGenTestSuite_test_write_matrix;
+
+static class TestDescription_suite_CodeGenTestSuite_test_read_matrix_errors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_read_matrix_errors() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 436, "test_read_matrix_errors" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_read_matrix_errors(); }
+} testDescription_suite_CodeGenTestSuite_test_read_matrix_errors;
+
+static class TestDescription_suite_CodeGenTestSuite_test_collections : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_collections() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 460, "test_collections" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_collections(); }
+} testDescription_suite_CodeGenTestSuite_test_collections;
+
+static class TestDescription_suite_CodeGenTestSuite_test_collections_fixed_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_collections_fixed_size() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 470, "test_collections_fixed_size" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_collections_fixed_size(); }
+} testDescription_suite_CodeGenTestSuite_test_collections_fixed_size;
+
+static class TestDescription_suite_CodeGenTestSuite_test_parfor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_parfor() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 478, "test_parfor" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_parfor(); }
+} testDescription_suite_CodeGenTestSuite_test_parfor;
+
+static class TestDescription_suite_CodeGenTestSuite_test_parfor_rewrites : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_parfor_rewrites() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 484, "test_parfor_rewrites" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_parfor_rewrites(); }
+} testDescription_suite_CodeGenTestSuite_test_parfor_rewrites;
+
+static class TestDescription_suite_CodeGenTestSuite_test_parfor_sums : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_parfor_sums() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 492, "test_parfor_sums" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_parfor_sums(); }
+} testDescription_suite_CodeGenTestSuite_test_parfor_sums;
+
+static class TestDescription_suite_CodeGenTestSuite_test_parfor_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_parfor_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 510, "test_parfor_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_parfor_error(); }
+} testDescription_suite_CodeGenTestSuite_test_parfor_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_collections_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_collections_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 522, "test_collections_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_collections_error(); }
+} testDescription_suite_CodeGenTestSuite_test_collections_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_bounds_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_bounds_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 547, "test_bounds_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_bounds_error(); }
+} testDescription_suite_CodeGenTestSuite_test_bounds_error;
+
+static class TestDescription_suite_CodeGenTestSuite_test_cube_axis_error : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_CodeGenTestSuite_test_cube_axis_error() : CxxTest::RealTestDescription( Tests_CodeGenTestSuite, suiteDescription_CodeGenTestSuite, 552, "test_cube_axis_error" ) {}
+ void runTest() { suite_CodeGenTestSuite.test_cube_axis_error(); }
+} testDescription_suite_CodeGenTestSuite_test_cube_axis_error;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
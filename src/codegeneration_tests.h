@@ -2,6 +2,7 @@
 #include <iostream> 
 #include "parser.h"
 #include "readInput.h"
+#include "translator.h"
 
 #include <stdlib.h>
 #include <string>
@@ -15,6 +16,7 @@ public:
 
     Parser p ;
     ParseResult pr ;
+    Translator t ;
 
     char **makeArgs ( const char *a0, const char *a1) {
         char **aa = (char **) malloc (sizeof(char *) * 2) ;
@@ -34,7 +36,15 @@ public:
         return readInput (2, makeArgs("translator", fn) ) ;
     }
 
-    void codegen_tests ( string filebase, bool checkExpected ) {
+    //! Default options with the one switch flag set.
+    CodeGenOptions with ( bool CodeGenOptions::*flag ) {
+        CodeGenOptions o ;
+        o.*flag = true ;
+        return o ;
+    }
+
+    void codegen_tests ( string filebase, bool checkExpected,
+                         CodeGenOptions options = CodeGenOptions() ) {
         string file = filebase + ".dsl" ;
         string path = "../samples/" + file ; 
         string cppbase =  "../samples/" + filebase ;
@@ -56,17 +66,17 @@ public:
         TSM_ASSERT ( file + " failed to generate an AST.", pr1.ast != NULL );
 	
 	// 3. Verify that the C++ code is non-empty.
+        Node::options = options ;
         string cpp1 = pr1.ast->cppCode() ;
+        Node::options = CodeGenOptions() ;
         TSM_ASSERT ( file + " failed to generate non-empty C++ code.", 
                      cpp1.length() > 0 ) ;
 
         writeFile ( cpp1, cppfile ) ;
 
-        // 4. Compile generated C++ file
+        // 4. Compile generated C++ file against libfcalrt
 	//cout << "Compiling ... " << endl;
-        string compile = "g++ ../samples/Matrix.cpp " + cppfile +
-                         " -o " + cppexec ;
-        rc = system ( compile.c_str() ) ;
+        rc = t.compile ( cppfile, cppexec ) ;
         TSM_ASSERT_EQUALS ( "translation of " + file + 
                             " failed to compile.", rc, 0 ) ;
 	
@@ -94,6 +104,27 @@ public:
     void test_sample_7 ( void ) { codegen_tests ( "sample_7", true ); }
     void test_sample_8 ( void ) { codegen_tests ( "sample_8", true ); }
 
+    //! A libfcalrt.a older than the runtime sources is not linked until
+    //! refreshLibrary rebuilds it.
+    void test_stale_library ( void ) {
+        string dir = "../samples/.fcal_stale_lib" ;
+        system ( ("rm -rf " + dir + " && mkdir " + dir + " && cp libfcalrt.a " + dir
+                  + " && touch -d 2000-01-01 " + dir + "/libfcalrt.a").c_str() ) ;
+        Translator stale ;
+        stale.libraryDir = dir ;
+        TS_ASSERT ( stale.compileCommand ( "x.cpp", "x" ).find ( "/Matrix.cpp" ) != string::npos ) ;
+        string cpp ;
+        TS_ASSERT ( stale.translate ( "../samples/sample_4.dsl", cpp ) ) ;
+        writeFile ( cpp, dir + "/sample_4.cpp" ) ;
+        TS_ASSERT_EQUALS ( stale.compile ( dir + "/sample_4.cpp", dir + "/sample_4" ), 0 ) ;
+        TS_ASSERT ( stale.compileCommand ( "x.cpp", "x" ).find ( "/Matrix.cpp" ) != string::npos ) ;
+        stale.refreshLibrary () ;
+        TS_ASSERT ( stale.compileCommand ( "x.cpp", "x" ).find ( "/libfcalrt.a" ) != string::npos ) ;
+        TS_ASSERT_EQUALS ( stale.compile ( dir + "/sample_4.cpp", dir + "/sample_4" ), 0 ) ;
+        TS_ASSERT_EQUALS ( system ( (dir + "/sample_4 | cmp -s - ../samples/sample_4.expected").c_str() ), 0 ) ;
+        system ( ("rm -rf " + dir).c_str() ) ;
+    }
+
      /* You should create .expected files in ../samples for these with the expected
      * output of your programs. You can then change the second argument to true to
      * validate these. */
@@ -101,6 +132,426 @@ public:
     void test_my_code_2 ( void ) { codegen_tests ( "my_code_2", true ) ; }
 
     void test_forest_loss ( void ) { codegen_tests ( "forest_loss_v2", true ); }
+
+    //! The same programs translated with the inlineable element accessor,
+    //! which replaces every out-of-line access call.
+    void inline_access_tests ( string filebase ) {
+        codegen_tests ( filebase, true, with ( &CodeGenOptions::inlineAccess ) );
+        char *cpp = readFile ( ("../samples/" + filebase + ".cpp").c_str() ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, ".at(" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, ".access(" ) == NULL ) ;
+    }
+    void test_sample_7_inline_access ( void ) { inline_access_tests ( "sample_7" ); }
+    void test_my_code_1_inline_access ( void ) { inline_access_tests ( "my_code_1" ); }
+
+    //! In-range programs are unaffected by bounds checking.
+    void test_sample_7_bounds_check ( void ) { codegen_tests ( "sample_7", true, with ( &CodeGenOptions::boundsCheck ) ); }
+    void test_my_code_1_bounds_check ( void ) { codegen_tests ( "my_code_1", true, with ( &CodeGenOptions::boundsCheck ) ); }
+
+    //! Rectangle sums give the same output through summed-area tables,
+    //! and loops that write their matrix or sum into an Int are left alone.
+    void test_rect_sum ( void ) { codegen_tests ( "rect_sum", true ); }
+    void test_rect_sum_prefix_sums ( void ) {
+        codegen_tests ( "rect_sum", true, with ( &CodeGenOptions::prefixSums ) );
+        char *cpp = readFile ( "../samples/rect_sum.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, ".prefixSums().rect(" ) != NULL ) ;
+    }
+    void test_my_code_1_prefix_sums ( void ) { codegen_tests ( "my_code_1", true, with ( &CodeGenOptions::prefixSums ) ); }
+
+    //! Row reductions give the same output through the vectorized kernels.
+    void test_row_reductions ( void ) { codegen_tests ( "row_reductions", true ); }
+    void test_row_reductions_vectorized ( void ) {
+        codegen_tests ( "row_reductions", true, with ( &CodeGenOptions::vectorReductions ) );
+        char *cpp = readFile ( "../samples/row_reductions.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, ".rowSum(" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, ".rowMax(" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, ".rowMin(" ) != NULL ) ;
+    }
+    void test_sample_7_vectorized ( void ) { codegen_tests ( "sample_7", true, with ( &CodeGenOptions::vectorReductions ) ); }
+
+    //! Guarded comprehensions stored as packed triangles read the same,
+    //! also through the prefix-sum and reduction rewrites.
+    void test_triangular ( void ) { codegen_tests ( "triangular", true ); }
+    void test_triangular_packed ( void ) {
+        codegen_tests ( "triangular", true, with ( &CodeGenOptions::triangular ) );
+        char *cpp = readFile ( "../samples/triangular.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "TriangularMatrix::Upper, 1," ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "TriangularMatrix::Lower, 0," ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "TriangularMatrix::Upper, 0, 0, true" ) != NULL ) ;
+    }
+    void test_triangular_packed_rewrites ( void ) {
+        CodeGenOptions o = with ( &CodeGenOptions::triangular ) ;
+        o.prefixSums = o.vectorReductions = true ;
+        codegen_tests ( "triangular", true, o );
+    }
+
+    //! Affine-index comprehensions read the same as views; printed,
+    //! guarded and aliased ones are still copied.
+    void test_reshape ( void ) { codegen_tests ( "reshape", true ); }
+    void test_reshape_views ( void ) {
+        codegen_tests ( "reshape", true, with ( &CodeGenOptions::views ) );
+        char *cpp = readFile ( "../samples/reshape.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "MatrixView<decltype(m)> back(" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "MatrixView<decltype(m)> t(" ) == NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "MatrixView<decltype(m)> padded(" ) == NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "MatrixView<decltype(n)>" ) == NULL ) ;
+    }
+    void test_reshape_views_reductions ( void ) {
+        CodeGenOptions o = with ( &CodeGenOptions::views ) ;
+        o.vectorReductions = true ;
+        codegen_tests ( "reshape", true, o );
+    }
+
+    //! Comprehensions with constant dimensions read the same on the stack.
+    void test_fixed_size ( void ) { codegen_tests ( "fixed_size", true ); }
+    void test_fixed_size_stack ( void ) {
+        codegen_tests ( "fixed_size", true, with ( &CodeGenOptions::fixedSize ) );
+        char *cpp = readFile ( "../samples/fixed_size.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "FixedMatrix<4, 3> b ;" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "FixedMatrix<2, 2>" ) == NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "Matrix c(" ) != NULL ) ;
+    }
+    void test_sample_7_fixed_size ( void ) { codegen_tests ( "sample_7", true, with ( &CodeGenOptions::fixedSize ) ); }
+
+    //! Matrix product triple loops give the same output through the
+    //! blocked GEMM.
+    void test_matmul ( void ) { codegen_tests ( "matmul", true ); }
+    void test_matmul_blocked ( void ) {
+        codegen_tests ( "matmul", true, with ( &CodeGenOptions::blockedMatmul ) );
+        char *cpp = readFile ( "../samples/matmul.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "Matrix::multiplyAdd(d, a, b," ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "Matrix::multiplyAdd(r, p, q," ) != NULL ) ;
+    }
+    void test_my_code_1_blocked_matmul ( void ) { codegen_tests ( "my_code_1", true, with ( &CodeGenOptions::blockedMatmul ) ); }
+
+    //! Whole-matrix operators, also with the rewrites that specialize
+    //! matrices, which must leave the operands heap Matrix objects.
+    void test_elementwise ( void ) { codegen_tests ( "elementwise", true ); }
+    void test_elementwise_rewrites ( void ) {
+        CodeGenOptions o = with ( &CodeGenOptions::views ) ;
+        o.fixedSize = o.triangular = o.prefixSums = o.vectorReductions = true ;
+        codegen_tests ( "elementwise", true, o );
+    }
+
+    //! Bool variables and constants, and && and || evaluating their
+    //! right operand only when needed.
+    void test_bools ( void ) { codegen_tests ( "bools", true ); }
+
+    //! Masks built from comparisons and comprehensions, combined,
+    //! counted and indexed, also with checked and inlined indexing.
+    void test_mask ( void ) { codegen_tests ( "mask", true ); }
+    void test_mask_bounds_check ( void ) { codegen_tests ( "mask", true, with ( &CodeGenOptions::boundsCheck ) ); }
+    void test_mask_inline_access ( void ) { inline_access_tests ( "mask" ); }
+
+    //! Masks combined with numbers or matrices.
+    void test_mask_error ( void ) {
+        string cpp ;
+        TS_ASSERT ( ! t.translate ( "../samples/mask_error.dsl", cpp ) ) ;
+        TS_ASSERT_EQUALS ( t.errors, "line 7: cannot apply + to Mask and Int\n"
+                                     "line 8: cannot apply && to Mask and Matrix" ) ;
+    }
+
+    void test_cube ( void ) { codegen_tests ( "cube", true ); }
+    void test_cube_bounds_check ( void ) { codegen_tests ( "cube", true, with ( &CodeGenOptions::boundsCheck ) ); }
+
+    //! A matrix that is never written is read as a cube in place; one
+    //! with another layout, or the value of an expression, is copied.
+    void test_cube_view ( void ) {
+        codegen_tests ( "cube", true ) ;
+        char *cpp = readFile ( "../samples/cube.cpp" ) ;
+        TS_ASSERT ( cpp != NULL ) ;
+        TS_ASSERT ( strstr ( cpp, "CubeView<decltype(data)> seasons(" ) != NULL ) ;
+        TS_ASSERT ( strstr ( cpp, "Cube bands = Cube::rowsOf(data, 4 , 2 , 6 , Cube::FirstFastest)" ) != NULL ) ;
+        TS_ASSERT ( strstr ( cpp, "Cube doubled = Cube::rowsOf(Matrix(" ) != NULL ) ;
+        TS_ASSERT ( strstr ( cpp, "}, Cube::FirstFastest) ;" ) != NULL ) ;
+    }
+
+    //! Wrong index counts, whole-cube arithmetic, a constant axis out of
+    //! range and a cube read from a number.
+    void test_cube_error ( void ) {
+        string cpp ;
+        TS_ASSERT ( ! t.translate ( "../samples/cube_error.dsl", cpp ) ) ;
+        TS_ASSERT_EQUALS ( t.errors, "line 8: Cube c takes 3 indices\n"
+                                     "line 9: Matrix a takes 2 indices\n"
+                                     "line 10: cannot apply + to Cube and Int\n"
+                                     "line 11: extent takes an axis 0, 1 or 2, not 3\n"
+                                     "line 12: Cube d reads the rows of a Matrix, not a Int" ) ;
+    }
+
+    void test_sparse ( void ) { codegen_tests ( "sparse", true ); }
+    void test_sparse_bounds_check ( void ) { codegen_tests ( "sparse", true, with ( &CodeGenOptions::boundsCheck ) ); }
+
+    //! The guard of a Sparse comprehension is passed apart from its cells.
+    void test_sparse_guard ( void ) {
+        string cpp ;
+        TS_ASSERT ( t.translate ( "../samples/sparse.dsl", cpp ) ) ;
+        TS_ASSERT ( cpp.find ( "-> bool { return ! ( (i > j) ) ; }, [&] (int i, int j) -> float { return  (i + j)  ; }" )
+                    != string::npos ) ;
+    }
+
+    //! Cell assignments, arithmetic and loops on the wrong kind of matrix.
+    void test_sparse_error ( void ) {
+        string cpp ;
+        TS_ASSERT ( ! t.translate ( "../samples/sparse_error.dsl", cpp ) ) ;
+        TS_ASSERT_EQUALS ( t.errors, "line 10: cannot assign to a cell of the Sparse s\n"
+                                     "line 11: cannot apply * to Sparse and Int\n"
+                                     "line 12: for ... in needs a Sparse matrix, not Matrix\n"
+                                     "line 13: map needs a Matrix, not Sparse" ) ;
+    }
+
+    //! Typed cells, and Int and Bool comprehensions narrowed to them,
+    //! which must print the same.
+    void test_typed ( void ) { codegen_tests ( "typed", true ); }
+    void test_typed_narrow ( void ) {
+        codegen_tests ( "typed", true, with ( &CodeGenOptions::narrowTypes ) );
+        char *cpp = readFile ( "../samples/typed.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "TypedMatrix<uint8_t> flags(" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "TypedMatrix<int32_t> place(" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "((float) *(flags.access(i, j)))" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "Matrix data(" ) != NULL ) ;
+    }
+    void test_sample_7_narrow ( void ) { codegen_tests ( "sample_7", true, with ( &CodeGenOptions::narrowTypes ) ); }
+
+    //! Matrices read and only indexed, held as 8- or 16-bit codes.
+    void test_quantized ( void ) { codegen_tests ( "quantized", true ); }
+    void test_quantized_codes ( void ) {
+        codegen_tests ( "quantized", true, with ( &CodeGenOptions::quantize ) );
+        char *cpp = readFile ( "../samples/quantized.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "QuantizedMatrix band(" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "QuantizedMatrix landClass(" ) != NULL ) ;
+    }
+    void test_my_code_1_quantize ( void ) { codegen_tests ( "my_code_1", true, with ( &CodeGenOptions::quantize ) ); }
+    //! Printed whole, so it stays a Matrix.
+    void test_sample_8_quantize ( void ) {
+        codegen_tests ( "sample_8", true, with ( &CodeGenOptions::quantize ) );
+        char *cpp = readFile ( "../samples/sample_8.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "QuantizedMatrix" ) == NULL ) ;
+    }
+
+    //! Comprehensions whose cells only read their own row, run as row
+    //! kernels; one reading the next row, or a whole matrix in matmul,
+    //! stays a loop.
+    void test_row_kernel ( void ) { codegen_tests ( "row_kernel", true ); }
+    void test_row_kernel_threads ( void ) {
+        codegen_tests ( "row_kernel", true, with ( &CodeGenOptions::rowKernels ) );
+        char *cpp = readFile ( "../samples/row_kernel.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "rowKernelRun(score, score_kernel)" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "rowKernelRun(change, change_kernel)" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "rowKernelRun(repeated, repeated_kernel)" ) != NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "rowKernelRun(smooth" ) == NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "rowKernelRun(yearly" ) == NULL ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "rowKernelRun(weighted" ) == NULL ) ;
+        string base = "../samples/row_kernel" ;
+        TS_ASSERT_EQUALS ( system ( ("FCAL_THREADS=4 " + base + " | cmp -s - "
+                                     + base + ".expected").c_str() ), 0 ) ;
+    }
+
+    //! A program with a tile parameter, run by runTiles over several
+    //! tiles; a missing tile fails alone.
+    void compileTiles ( ) {
+        string cpp ;
+        TS_ASSERT ( t.translate ( "../samples/tiles.dsl", cpp ) ) ;
+        TS_ASSERT ( cpp.find ( "static void fcalProgram (string tile)" ) != string::npos ) ;
+        writeFile ( cpp, "../samples/tiles.cpp" ) ;
+        TS_ASSERT_EQUALS ( t.compile ( "../samples/tiles.cpp", "../samples/tiles" ), 0 ) ;
+    }
+    int sameOutput ( string tile, string expected ) {
+        return system ( ("cmp -s " + tile + ".out " + expected).c_str() ) ;
+    }
+    void test_tiles ( void ) {
+        compileTiles () ;
+        string base = "../samples/tiles" ;
+        system ( ("rm -f " + base + "_*.data.out").c_str() ) ;
+        TS_ASSERT_EQUALS ( system ( (base + " -j 2 " + base + "_1.data " + base + "_2.data "
+                                     + base + "_3.data").c_str() ), 0 ) ;
+        TS_ASSERT_EQUALS ( sameOutput ( base + "_1.data", base + "_1.expected" ), 0 ) ;
+        TS_ASSERT_EQUALS ( sameOutput ( base + "_2.data", base + "_2.expected" ), 0 ) ;
+        TS_ASSERT_EQUALS ( sameOutput ( base + "_3.data", base + "_3.expected" ), 0 ) ;
+    }
+    void test_tiles_failure ( void ) {
+        compileTiles () ;
+        string base = "../samples/tiles" ;
+        system ( ("rm -f " + base + "_*.data.out").c_str() ) ;
+        writeFile ( base + "_3.data\n" + base + "_missing.data\n" + base + "_1.data", base + ".list" ) ;
+        int rc = system ( (base + " --memory 1 --list " + base + ".list 2> /dev/null").c_str() ) ;
+        TS_ASSERT ( WIFEXITED ( rc ) && WEXITSTATUS ( rc ) == 1 ) ;
+        TS_ASSERT_EQUALS ( sameOutput ( base + "_1.data", base + "_1.expected" ), 0 ) ;
+        TS_ASSERT_EQUALS ( sameOutput ( base + "_3.data", base + "_3.expected" ), 0 ) ;
+    }
+
+    //! Builtins called with the wrong number of arguments, or as a
+    //! statement without an effect.
+    void test_arity_error ( void ) {
+        string cpp ;
+        TS_ASSERT ( ! t.translate ( "../samples/arity_error.dsl", cpp ) ) ;
+        TS_ASSERT_EQUALS ( t.errors, "line 7: numRows takes 1 argument, not 2\n"
+                                     "line 8: matmul takes 2 arguments, not 1\n"
+                                     "line 9: count takes 1 argument, not 2\n"
+                                     "line 10: numCols has no effect as a statement" ) ;
+    }
+
+    //! Whole-matrix operators on typed matrices, and Floats in Int and
+    //! Byte cells.
+    void test_typed_error ( void ) {
+        string cpp ;
+        TS_ASSERT ( ! t.translate ( "../samples/typed_error.dsl", cpp ) ) ;
+        TS_ASSERT_EQUALS ( t.errors, "line 8: cannot apply + to Matrix<Int> and Int\n"
+                                     "line 9: cannot apply * to Matrix<Double> and Matrix<Double>\n"
+                                     "line 10: cannot give a cell of the Matrix<Int> c a Float\n"
+                                     "line 13: cannot give a cell of the Matrix<Byte> d a Float\n"
+                                     "line 15: cannot give a cell of the Matrix<Byte> e an Int that may be out of 0 .. 255\n"
+                                     "line 16: cannot give a cell of the Matrix<Byte> d an Int that may be out of 0 .. 255" ) ;
+    }
+
+    //! Element-wise operators on strings are reported with their line.
+    void test_elementwise_error ( void ) {
+        string cpp ;
+        TS_ASSERT ( ! t.translate ( "../samples/elementwise_error.dsl", cpp ) ) ;
+        TS_ASSERT_EQUALS ( t.errors, "line 8: cannot apply + to Matrix and Str\n"
+                                     "line 9: cannot apply < to Str and Matrix\n"
+                                     "line 11: && does not apply to matrices" ) ;
+    }
+
+    //! The print statement keeps the iostream format by default; the
+    //! shortest and binary formats are chosen with FCAL_PRINT.
+    void test_print_formats ( void ) {
+        codegen_tests ( "print_formats", true );
+        string base = "../samples/print_formats" ;
+        TS_ASSERT_EQUALS ( system ( ("FCAL_PRINT=shortest " + base + " > " + base
+                                     + ".output").c_str() ), 0 ) ;
+        char *output = readFile ( (base + ".output").c_str() ) ;
+        TS_ASSERT ( output != NULL && strstr ( output, "0.33333334  0.25  0.2  \n" ) != NULL ) ;
+        TS_ASSERT ( output != NULL && strstr ( output, "1234567 1234567000 " ) != NULL ) ;
+        TS_ASSERT_EQUALS ( system ( ("FCAL_PRINT=binary " + base + " > " + base
+                                     + ".output").c_str() ), 0 ) ;
+        output = readFile ( (base + ".output").c_str() ) ;
+        TS_ASSERT ( output != NULL && memcmp ( output, "FCM1\2\0\0\0\3\0\0\0", 12 ) == 0 ) ;
+    }
+
+    //! A matrix written with writeMatrix reads back exactly.
+    void test_write_matrix ( void ) { codegen_tests ( "write_matrix", true ); }
+
+    //! Matrix files with a short or impossible header are reported like
+    //! a missing file, instead of allocating from garbage sizes.
+    void test_read_matrix_errors ( void ) {
+        string cpp, base = "../samples/read_error" ;
+        TS_ASSERT ( t.translate ( base + ".dsl", cpp ) ) ;
+        writeFile ( cpp, base + ".cpp" ) ;
+        TS_ASSERT_EQUALS ( t.compile ( base + ".cpp", base ), 0 ) ;
+        const int huge = 1 << 30 ;
+        int negative[2] = { -1, 3 }, large[2] = { huge, huge } ;
+        string files[] = { string ( "FCM1\2\0\0", 7 ),
+                           string ( "FCM1" ) + string ( (const char *) negative, 8 ),
+                           string ( "FCM1" ) + string ( (const char *) large, 8 ),
+                           "3 3\n1 2" } ;
+        for ( int i = 0; i < 4; i ++ ) {
+            ofstream out ( ( base + ".fcm" ).c_str(), ios::binary ) ;
+            out << files[i] ;
+            out.close () ;
+            int rc = system ( ( base + " > /dev/null 2> " + base + ".output" ).c_str() ) ;
+            TS_ASSERT ( WIFEXITED ( rc ) && WEXITSTATUS ( rc ) == 1 ) ;
+            char *err = readFile ( ( base + ".output" ).c_str() ) ;
+            TS_ASSERT ( err != NULL && strstr ( err, "Bad matrix file : ../samples/read_error.fcm" ) != NULL ) ;
+        }
+    }
+
+    //! The collection operators print the same for any number of
+    //! threads; a body with a let is run sequentially.
+    void test_collections ( void ) {
+        codegen_tests ( "collections", true );
+        char *cpp = readFile ( "../samples/collections.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "; } , false)" ) != NULL ) ;
+        string base = "../samples/collections" ;
+        TS_ASSERT_EQUALS ( system ( ("FCAL_THREADS=4 " + base + " | cmp -s - "
+                                     + base + ".expected").c_str() ), 0 ) ;
+    }
+    //! A cell variable does not hide the outer variable of the same name
+    //! from the rewrites, nor do they see the outer one in the body.
+    void test_collections_fixed_size ( void ) {
+        codegen_tests ( "collections", true, with ( &CodeGenOptions::fixedSize ) );
+        char *cpp = readFile ( "../samples/collections.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "FixedMatrix<2, 3> small ;" ) != NULL ) ;
+    }
+
+    //! parfor reductions give the same numbers for any number of
+    //! threads, also when the loops in the body are rewritten.
+    void test_parfor ( void ) {
+        codegen_tests ( "parfor", true );
+        string base = "../samples/parfor" ;
+        TS_ASSERT_EQUALS ( system ( ("FCAL_THREADS=3 " + base + " | cmp -s - "
+                                     + base + ".expected").c_str() ), 0 ) ;
+    }
+    void test_parfor_rewrites ( void ) {
+        CodeGenOptions o = with ( &CodeGenOptions::views ) ;
+        o.fixedSize = o.triangular = o.prefixSums = o.vectorReductions = o.blockedMatmul = true ;
+        codegen_tests ( "parfor", true, o );
+    }
+
+    //! The summed-area table of a rectangle sum in a parfor is built
+    //! before the threads start; ThreadSanitizer finds no race.
+    void test_parfor_sums ( void ) {
+        codegen_tests ( "parfor_sums", true, with ( &CodeGenOptions::prefixSums ) );
+        char *cpp = readFile ( "../samples/parfor_sums.cpp" ) ;
+        TS_ASSERT ( cpp != NULL && strstr ( cpp, "m.prefixSums() ; \nint parts_" ) != NULL ) ;
+        Translator tsan ;
+        tsan.libraryDir = "../samples/.fcal_tsan" ; // no libfcalrt.a, so Matrix.cpp is instrumented
+        tsan.compileFlags = "-O1 -g -fsanitize=thread" ;
+        tsan.options = with ( &CodeGenOptions::prefixSums ) ;
+        string base = "../samples/parfor_sums_tsan", code ;
+        TS_ASSERT ( tsan.translate ( "../samples/parfor_sums.dsl", code ) ) ;
+        writeFile ( code, base + ".cpp" ) ;
+        TS_ASSERT_EQUALS ( tsan.compile ( base + ".cpp", base ), 0 ) ;
+        TS_ASSERT_EQUALS ( system ( ("FCAL_THREADS=4 TSAN_OPTIONS=halt_on_error=1 " + base
+                                     + " | cmp -s - ../samples/parfor_sums.expected").c_str() ), 0 ) ;
+    }
+
+    //! parfor reductions of non-numbers, assignments to shared matrices
+    //! and mask cells, and output from the iterations.
+    void test_parfor_error ( void ) {
+        string cpp ;
+        TS_ASSERT ( ! t.translate ( "../samples/parfor_error.dsl", cpp ) ) ;
+        TS_ASSERT_EQUALS ( t.errors, "line 10: parfor reduces Int and Float variables, not Str\n"
+                                     "line 10: parfor reduces Int and Float variables, not Matrix\n"
+                                     "line 10: parfor iterations cannot all assign the Matrix b\n"
+                                     "line 13: parfor iterations cannot print\n"
+                                     "line 13: parfor iterations cannot call writeMatrix\n"
+                                     "line 18: parfor iterations cannot assign cells of the Mask k" ) ;
+    }
+
+    //! Collection operators over strings, or with matrix cells.
+    void test_collections_error ( void ) {
+        string cpp ;
+        TS_ASSERT ( ! t.translate ( "../samples/collections_error.dsl", cpp ) ) ;
+        TS_ASSERT_EQUALS ( t.errors, "line 8: map needs a Matrix, not Str\n"
+                                     "line 9: zip needs a number for each cell, not Matrix" ) ;
+    }
+
+    //! Translates filebase with bounds checking, runs it and checks that it
+    //! stops with message.
+    void bounds_error_tests ( string filebase, const char *message ) {
+        string base = "../samples/" + filebase ;
+        ParseResult pr1 = p.parse ( readFile ( (base + ".dsl").c_str() ) ) ;
+        TS_ASSERT ( pr1.ok ) ;
+        Node::options = with ( &CodeGenOptions::boundsCheck ) ;
+        writeFile ( pr1.ast->cppCode(), base + ".cpp" ) ;
+        Node::options = CodeGenOptions() ;
+        TS_ASSERT_EQUALS ( t.compile ( base + ".cpp", base ), 0 ) ;
+        int rc = system ( (base + " > " + base + ".output 2>&1").c_str() ) ;
+        TS_ASSERT_DIFFERS ( rc, 0 ) ;
+        char *output = readFile ( (base + ".output").c_str() ) ;
+        TS_ASSERT ( output != NULL ) ;
+        TS_ASSERT ( strstr ( output, message ) != NULL ) ;
+    }
+
+    //! An out of range index stops the program and names its source line.
+    void test_bounds_error ( void ) {
+        bounds_error_tests ( "bounds_error", "line 8: index (1, 3) out of bounds in m [1" ) ;
+    }
+
+    //! So does the extent of an axis a cube does not have.
+    void test_cube_axis_error ( void ) {
+        bounds_error_tests ( "cube_axis_error", "line 9: axis 3 out of bounds in extent (c , axis)" ) ;
+    }
 } ;
 
 
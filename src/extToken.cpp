@@ -24,8 +24,14 @@ ExtToken *extendToken (Parser *p, Token *tokens) {
     case elseKwd: return new ExtToken(p,tokens,"'else'") ;
     case printKwd: return new ExtToken(p,tokens,"'print'") ;
     case forKwd: return new ExtToken(p,tokens,"'for'") ;
+    case parforKwd: return new ExtToken(p,tokens,"'parfor'") ;
+    case reduceKwd: return new ExtToken(p,tokens,"'reduce'") ;
     case thenKwd: return new ExtToken(p,tokens,"'then'") ;
     case whileKwd: return new ExtToken(p,tokens,"'while'") ;
+    case mapKwd: return new MapKwdToken(p,tokens) ;
+    case filterKwd: return new FilterKwdToken(p,tokens) ;
+    case foldKwd: return new FoldKwdToken(p,tokens) ;
+    case zipKwd: return new ZipKwdToken(p,tokens) ;
     // Keywords
 
 
@@ -33,6 +39,11 @@ ExtToken *extendToken (Parser *p, Token *tokens) {
     case floatKwd: return new ExtToken(p,tokens,"'Float'") ;
     case stringKwd: return new ExtToken(p,tokens,"'Str'") ;
     case boolKwd: return new ExtToken(p,tokens,"'Bool'") ;
+    case maskKwd: return new ExtToken(p,tokens,"'Mask'") ;
+    case cubeKwd: return new ExtToken(p,tokens,"'Cube'") ;
+    case sparseKwd: return new ExtToken(p,tokens,"'Sparse'") ;
+    case doubleKwd: return new ExtToken(p,tokens,"'Double'") ;
+    case byteKwd: return new ExtToken(p,tokens,"'Byte'") ;
     case trueKwd: return new TrueKwdToken(p,tokens) ;
     case falseKwd: return new FalseKwdToken(p,tokens) ;
     case matrixKwd: return new ExtToken(p,tokens,"'Matrix'") ;
@@ -74,6 +85,8 @@ ExtToken *extendToken (Parser *p, Token *tokens) {
     case notEquals: 
         return new RelationalOpToken(p, tokens, tokens->lexeme) ;
     
+    case andOp: return new AndOpToken(p,tokens) ;
+    case orOp: return new OrOpToken(p,tokens) ;
     case notOp:
         return new NotOpToken(p,tokens);
 
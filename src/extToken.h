@@ -15,9 +15,9 @@
 class ExtToken {
 public:
     ExtToken (Parser *p, Token *t) 
-        : lexeme(t->lexeme), terminal(t->terminal), parser(p) { }
+        : lexeme(t->lexeme), terminal(t->terminal), next(NULL), line(t->line), parser(p) { }
     ExtToken (Parser *p, Token *t, std::string d) 
-        : lexeme(t->lexeme), terminal(t->terminal), parser(p), descStr(d) { }
+        : lexeme(t->lexeme), terminal(t->terminal), next(NULL), line(t->line), parser(p), descStr(d) { }
 
     virtual ~ExtToken () { } ;
 
@@ -31,6 +31,7 @@ public:
     std::string lexeme ;
     tokenType terminal ;
     ExtToken *next ;
+    int line ;
     Parser *parser;
 
     virtual int lbp() { return 0 ; }
@@ -114,6 +115,35 @@ public:
     std::string description() { return "variable name"; }
 } ;
 
+// Collection operators over the cells of a matrix
+class MapKwdToken : public ExtToken {
+public:
+    MapKwdToken (Parser *p, Token *t) : ExtToken(p,t) { }
+    ParseResult nud () { return parser->parseMapExpr (); }
+    std::string description() { return "'map'"; }
+} ;
+
+class FilterKwdToken : public ExtToken {
+public:
+    FilterKwdToken (Parser *p, Token *t) : ExtToken(p,t) { }
+    ParseResult nud () { return parser->parseFilterExpr (); }
+    std::string description() { return "'filter'"; }
+} ;
+
+class FoldKwdToken : public ExtToken {
+public:
+    FoldKwdToken (Parser *p, Token *t) : ExtToken(p,t) { }
+    ParseResult nud () { return parser->parseFoldExpr (); }
+    std::string description() { return "'fold'"; }
+} ;
+
+class ZipKwdToken : public ExtToken {
+public:
+    ZipKwdToken (Parser *p, Token *t) : ExtToken(p,t) { }
+    ParseResult nud () { return parser->parseZipExpr (); }
+    std::string description() { return "'zip'"; }
+} ;
+
 class IfToken:public ExtToken{
     public:
     IfToken (Parser *p, Token *t) : ExtToken(p,t) { };
@@ -192,6 +222,28 @@ public:
     int lbp() { return 30; }
 } ;
 
+// And Op, binding tighter than Or Op and looser than the comparisons
+class AndOpToken : public ExtToken {
+public:
+    AndOpToken (Parser *p, Token *t) : ExtToken(p,t) { }
+    ParseResult led (ParseResult left) {
+        return parser->parseLogicalExpr (left) ;
+    }
+    std::string description() { return "'&&'"; }
+    int lbp() { return 20; }
+} ;
+
+// Or Op
+class OrOpToken : public ExtToken {
+public:
+    OrOpToken (Parser *p, Token *t) : ExtToken(p,t) { }
+    ParseResult led (ParseResult left) {
+        return parser->parseLogicalExpr (left) ;
+    }
+    std::string description() { return "'||'"; }
+    int lbp() { return 10; }
+} ;
+
 
 // End of File
 class EndOfFileToken : public ExtToken {
@@ -359,38 +411,6 @@ public:
     std::string description() { return "'Null'"; }
 } ;
 
-// Map Kwd
-class MapKwdToken : public ExtToken {
-public:
-    MapKwdToken (Parser *p, Token *t) : ExtToken(p,t) { }
-    ParseResult nud () { return parser->parseMapExpr (); }
-    std::string description() { return "'Map'"; }
-} ;
-
-// Filter Kwd
-class FilterKwdToken : public ExtToken {
-public:
-    FilterKwdToken (Parser *p, Token *t) : ExtToken(p,t) { }
-    ParseResult nud () { return parser->parseFilterExpr (); }
-    std::string description() { return "filter"; }
-} ;
-
-// Fold Kwd
-class FoldKwdToken : public ExtToken {
-public:
-    FoldKwdToken (Parser *p, Token *t) : ExtToken(p,t) { }
-    ParseResult nud () { return parser->parseFoldExpr (); }
-    std::string description() { return "fold"; }
-} ;
-
-// Zip Kwd
-class ZipKwdToken : public ExtToken {
-public:
-    ZipKwdToken (Parser *p, Token *t) : ExtToken(p,t) { }
-    ParseResult nud () { return parser->parseZipExpr (); }
-    std::string description() { return "zip"; }
-} ;
-
 
 // Int Const
 class IntConstToken : public ExtToken {
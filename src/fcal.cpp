@@ -0,0 +1,127 @@
+/*! \file fcal.cpp
+    \brief Command line driver: translates an FCAL program to C++ and
+    compiles it against the Matrix runtime.
+
+    Usage: fcal [options] program.dsl
+
+      -o <exe>             name of the executable (default: program)
+      --no-compile         only write program.cpp
+      --runtime <dir>      directory holding fcalrt.h, Matrix.h and Matrix.cpp
+      --lib <dir>          directory holding libfcalrt.a (default: .)
+      --inline-access      index matrices through the inlineable Matrix::at
+      --bounds-check       check every matrix index, reporting its source line
+      --prefix-sums        sum rectangles of read-only matrices via summed-area tables
+      --vector-reductions  run sum/max/min loops over matrix rows as vectorized
+                           kernels; reassociates sums
+      --triangular         store comprehensions with a constant or mirrored
+                           triangle as packed TriangularMatrix objects
+      --views              bind affine-index comprehensions to views of the
+                           matrix they read instead of copying it
+      --fixed-size         hold comprehensions with small constant dimensions
+                           in FixedMatrix objects on the stack
+      --blocked-matmul     run matrix multiplication triple loops through the
+                           blocked, vectorized Matrix::multiplyAdd
+      --narrow-types       store read-only Int and Bool comprehensions with
+                           32- or 8-bit integer cells
+      --quantize           hold matrices read by readMatrix and only indexed
+                           as 8- or 16-bit codes into a table of their values
+      --row-kernels        compute comprehensions whose cells only read their
+                           own row as kernels over blocks of rows, in parallel
+                           with FCAL_THREADS
+      --cache <dir>        reuse translations and binaries cached in dir
+      --cache-size <bytes> size bound of the cache (default 256 MB)
+      --cache-stats        print the cache hit/miss counters when done
+*/
+
+#include "translator.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include <fstream>
+#include <string>
+
+using namespace std ;
+
+static int usage (const char *prog) {
+    cerr << "Usage: " << prog << " [options] program.dsl" << endl
+         << "  -o <exe>             name of the executable" << endl
+         << "  --no-compile         only write program.cpp" << endl
+         << "  --runtime <dir>      directory holding the Matrix runtime sources" << endl
+         << "  --lib <dir>          directory holding libfcalrt.a" << endl
+         << "  --inline-access      index matrices through Matrix::at" << endl
+         << "  --bounds-check       check every matrix index" << endl
+         << "  --prefix-sums        sum matrix rectangles via summed-area tables" << endl
+         << "  --vector-reductions  vectorize sum/max/min loops over matrix rows" << endl
+         << "  --triangular         pack comprehensions with a constant triangle" << endl
+         << "  --views              make affine-index comprehensions views" << endl
+         << "  --fixed-size         put small constant-size comprehensions on the stack" << endl
+         << "  --blocked-matmul     run matrix multiplication loops as a blocked GEMM" << endl
+         << "  --narrow-types       store Int and Bool comprehensions in integer cells" << endl
+         << "  --quantize           hold read-only input matrices as 8- or 16-bit codes" << endl
+         << "  --row-kernels        run per-row comprehensions as parallel row kernels" << endl
+         << "  --cache <dir>        reuse cached translations and binaries" << endl
+         << "  --cache-size <bytes> size bound of the cache" << endl
+         << "  --cache-stats        print the cache counters when done" << endl ;
+    return 2 ;
+}
+
+int main (int argc, char **argv) {
+    Translator t ;
+    string input, exe, cacheDir ;
+    long cacheSize = 256L * 1024 * 1024 ;
+    bool compile = true, cacheStats = false ;
+
+    for (int i = 1; i < argc; i ++) {
+        string arg (argv[i]) ;
+        bool hasValue = i + 1 < argc ;
+        if (arg == "-o" && hasValue) exe = argv[++i] ;
+        else if (arg == "--no-compile") compile = false ;
+        else if (arg == "--runtime" && hasValue) t.runtimeDir = argv[++i] ;
+        else if (arg == "--lib" && hasValue) t.libraryDir = argv[++i] ;
+        else if (arg == "--inline-access") t.options.inlineAccess = true ;
+        else if (arg == "--bounds-check") t.options.boundsCheck = true ;
+        else if (arg == "--prefix-sums") t.options.prefixSums = true ;
+        else if (arg == "--vector-reductions") t.options.vectorReductions = true ;
+        else if (arg == "--triangular") t.options.triangular = true ;
+        else if (arg == "--views") t.options.views = true ;
+        else if (arg == "--fixed-size") t.options.fixedSize = true ;
+        else if (arg == "--blocked-matmul") t.options.blockedMatmul = true ;
+        else if (arg == "--narrow-types") t.options.narrowTypes = true ;
+        else if (arg == "--quantize") t.options.quantize = true ;
+        else if (arg == "--row-kernels") t.options.rowKernels = true ;
+        else if (arg == "--cache" && hasValue) cacheDir = argv[++i] ;
+        else if (arg == "--cache-size" && hasValue) cacheSize = atol (argv[++i]) ;
+        else if (arg == "--cache-stats") cacheStats = true ;
+        else if (arg[0] != '-' && input.empty()) input = arg ;
+        else return usage (argv[0]) ;
+    }
+    if (input.empty()) return usage (argv[0]) ;
+
+    string base = input ;
+    if (base.size() > 4 && base.substr (base.size() - 4) == ".dsl")
+        base = base.substr (0, base.size() - 4) ;
+    if (exe.empty()) exe = base ;
+    string cppFile = base + ".cpp" ;
+
+    if (!cacheDir.empty()) t.useCache (cacheDir, cacheSize) ;
+
+    string cpp ;
+    if (!t.translate (input, cpp)) {
+        cerr << input << ": " << t.errors << endl ;
+        return 1 ;
+    }
+    ofstream out (cppFile.c_str()) ;
+    out << cpp << endl ;
+    out.close () ;
+
+    int rc = 0 ;
+    if (compile) t.refreshLibrary () ;
+    if (compile && t.compile (cppFile, exe) != 0) {
+        cerr << "translation of " << input << " failed to compile" << endl ;
+        rc = 1 ;
+    }
+
+    if (cacheStats && t.cache) cerr << t.cache->stats() << endl ;
+    return rc ;
+}
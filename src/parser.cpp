@@ -35,8 +35,23 @@ using namespace std ;
 
 /*! Destructor for parser.*/
 Parser::~Parser() {
+    reset() ;
     if (s) delete s ;
+}
+
+
+/*! Constructor for parser*/
+Parser::Parser ( ) { 
+    currToken = NULL; prevToken = NULL ; tokens = NULL; 
+    s = NULL; stokens = NULL; 
+}
 
+/*! \fn void Parser::reset ()
+    \brief Frees the extended tokens of the last input and hands the
+    scanner tokens back to the scanner for reuse, so that one Parser
+    can parse many inputs back-to-back without leaking.
+*/
+void Parser::reset () {
     ExtToken *extTokenToDelete ;
     currToken = tokens ;
     while (currToken) {
@@ -45,21 +60,10 @@ Parser::~Parser() {
         delete extTokenToDelete ;
     }
 
-    Token *tokenToDelete ;
-    Token *currScannerToken = stokens ;
-    while (currScannerToken) {
-        tokenToDelete = currScannerToken ;
-        currScannerToken = currScannerToken->next ;
-        delete tokenToDelete ;
-    }
-
-}
-
+    if (s) s->recycle (stokens) ;
 
-/*! Constructor for parser*/
-Parser::Parser ( ) { 
-    currToken = NULL; prevToken = NULL ; tokens = NULL; 
-    s = NULL; stokens = NULL; 
+    tokens = NULL ; stokens = NULL ;
+    currToken = NULL ; prevToken = NULL ;
 }
 
 ParseResult Parser::parse (const char *text) {
@@ -67,11 +71,7 @@ ParseResult Parser::parse (const char *text) {
 
     ParseResult pr ;
     try {
-        s = new Scanner() ;
-        stokens = s->scan (text) ;        
-        tokens = extendTokenList ( this, stokens ) ;
-
-        assert (tokens != NULL) ;
+        initialzeParser (text) ;
         currToken = tokens ;
         pr = parseProgram( ) ;
     }
@@ -83,15 +83,14 @@ ParseResult Parser::parse (const char *text) {
     return pr ;
 }
 
-//! Function for implementation and testing purposes only
+//! Scans text into a fresh token list, reusing the scanner between inputs.
 void Parser::initialzeParser (const char* text) {
+    reset() ;
+    if (s == NULL) s = new Scanner() ;
+    stokens = s->scan (text) ;        
+    tokens = extendTokenList ( this, stokens ) ;
 
-	// used during dev only to be removed in final product... :D 
-	s = new Scanner();
-	stokens = s->scan (text) ;        
-        tokens = extendTokenList ( this, stokens ) ;
-
-        assert (tokens != NULL) ;
+    assert (tokens != NULL) ;
 }
 
 
@@ -108,10 +107,13 @@ ParseResult Parser::parseProgram () {
     
     ParseResult pr ;
     // root
-    // Program ::= varName '(' ')' '{' Stmts '}' 
+    // Program ::= varName '(' [ varName ] ')' '{' Stmts '}' 
     match(variableName) ;
     string name( prevToken->lexeme ) ;
     match(leftParen) ;
+    VarName *parameter = NULL ;
+    if (attemptMatch(variableName))
+        parameter = new VarName(prevToken->lexeme) ;
     match(rightParen) ;
     match(leftCurly);
     ParseResult prStmts = parseStmts() ;
@@ -128,7 +130,7 @@ ParseResult Parser::parseProgram () {
 		if(!s) throw ((string) "Bad cast of Stmts in parseProgram");
 	}
 	
-	pr.ast = new Root(v,s);
+	pr.ast = new Root(v,s,parameter);
     return pr ;
 }
 
@@ -138,10 +140,62 @@ ParseResult Parser::parseProgram () {
 */ 
 ParseResult Parser::parseMatrixDecl () {
     ParseResult pr ;
-    match(matrixKwd);
+    // Decl ::= 'Cube' ['<' Layout '>'] varName '[' Expr ',' Expr ',' Expr ']' varName ',' varName ',' varName '=' Expr ';'
+    // Decl ::= 'Cube' ['<' Layout '>'] varName '[' Expr ',' Expr ',' Expr ']' '=' Expr ';', the rows of a Matrix as a Cube
+    if(attemptMatch(cubeKwd)){
+        string layout = "LastFastest";
+        if (attemptMatch(lessThan)) {
+            if (!nextIs(variableName)
+                || (currToken->lexeme != "LastFastest" && currToken->lexeme != "FirstFastest"))
+                throw ( makeErrorMsg ( "Cube layouts are one of LastFastest FirstFastest" ) ) ;
+            match(variableName) ;
+            layout = prevToken->lexeme;
+            match(greaterThan);
+        }
+        match(variableName) ;
+        VarName *name = new VarName(prevToken->lexeme);
+        int line = prevToken->line;
+        match(leftSquare);
+        Expr *extents[3] ;
+        for (int axis = 0; axis < 3; axis ++) {
+            if (axis > 0) match(comma);
+            extents[axis] = dynamic_cast<Expr *>(parseExpr(0).ast);
+        }
+        match(rightSquare);
+        if (attemptMatch(assign)) {
+            Expr *source = dynamic_cast<Expr *>(parseExpr(0).ast);
+            match(semiColon) ;
+            pr.ast = new CubeDecl(name,extents,source,layout,line);
+            return pr ;
+        }
+        VarName *indices[3] ;
+        for (int axis = 0; axis < 3; axis ++) {
+            if (axis > 0) match(comma);
+            indices[axis] = dynamic_cast<VarName *>(parseVariableName().ast);
+        }
+        match(assign);
+        Expr *cell = dynamic_cast<Expr *>(parseExpr(0).ast);
+        match(semiColon) ;
+        pr.ast = new LongCubeDecl(name,indices,extents,cell,layout);
+        return pr ;
+    }
+    // Decl ::= 'Mask' ..., the same forms declaring a Mask
+    // Decl ::= 'Sparse' ..., the comprehension declaring a SparseMatrix
+    bool mask = attemptMatch(maskKwd);
+    bool sparse = !mask && attemptMatch(sparseKwd);
+    // Decl ::= 'Matrix' '<' ElementType '>' varName '[' ... ']' ..., a typed comprehension
+    string element = "Float";
+    if (!mask && !sparse) {
+        match(matrixKwd);
+        if (attemptMatch(lessThan)) {
+            element = parseElementType();
+            match(greaterThan);
+        }
+    }
     match(variableName) ;
 
 	VarName *name = new VarName(prevToken->lexeme);
+	int line = prevToken->line;
     // Decl ::= 'Matrix' varName '[' Expr ',' Expr ']' varName ',' varName  '=' Expr ';'
     if(attemptMatch(leftSquare)){
         ParseResult firstPr = parseExpr(0);
@@ -164,13 +218,16 @@ ParseResult Parser::parseMatrixDecl () {
         ParseResult prExpr = parseExpr(0);
         Expr *lastExpr = dynamic_cast<Expr *>(prExpr.ast);
         
-        pr.ast = new LongMatrixDecl(name,var1,var2,firstExpr,secondExpr,lastExpr);
+        if (mask) pr.ast = new LongMaskDecl(name,var1,var2,firstExpr,secondExpr,lastExpr);
+        else if (sparse) pr.ast = new LongSparseDecl(name,var1,var2,firstExpr,secondExpr,lastExpr);
+        else pr.ast = new LongMatrixDecl(name,var1,var2,firstExpr,secondExpr,lastExpr,element,line);
     }
     // Decl ::= 'Matrix' varName '=' Expr ';'
-    else if(attemptMatch(assign)){
+    else if(!sparse && element == "Float" && attemptMatch(assign)){
         ParseResult prExpr = parseExpr(0);
         Expr *aExpr = dynamic_cast<Expr *>(prExpr.ast);
-        pr.ast = new MatrixDecl(name, aExpr);
+        if (mask) pr.ast = new MaskDecl(name, aExpr);
+        else pr.ast = new MatrixDecl(name, aExpr);
     }
     else{
         throw ( (string) "Bad Syntax of Matrix Decl in in parseMatrixDecl" ) ;
@@ -219,7 +276,7 @@ ParseResult Parser::parseStandardDecl(){
 ParseResult Parser::parseDecl () {
     ParseResult pr ;
     // Decl :: Matrix variableName ....
-    if(nextIs(matrixKwd)){
+    if(nextIs(matrixKwd)||nextIs(maskKwd)||nextIs(cubeKwd)||nextIs(sparseKwd)){
         pr =parseMatrixDecl();
     } 
     // Decl ::= Type variableName semiColon
@@ -260,7 +317,7 @@ ParseResult Parser::parseStmt () {
     ParseResult pr ;
 
     //Stmt ::= Decl
-    if(nextIs(intKwd)||nextIs(floatKwd)||nextIs(matrixKwd)||nextIs(stringKwd)||nextIs(boolKwd)){
+    if(nextIs(intKwd)||nextIs(floatKwd)||nextIs(matrixKwd)||nextIs(stringKwd)||nextIs(boolKwd)||nextIs(maskKwd)||nextIs(cubeKwd)||nextIs(sparseKwd)){
         ParseResult prDecl = parseDecl();
         Decl * decl = dynamic_cast<Decl *>(prDecl.ast);
         pr.ast = new DeclStmt(decl);
@@ -291,9 +348,10 @@ ParseResult Parser::parseStmt () {
         }
 
     }
-    //Stmt ::= varName '=' Expr ';'  | varName '[' Expr ',' Expr ']' '=' Expr ';'
+    //Stmt ::= varName '=' Expr ';'  | varName '[' Expr ',' Expr [',' Expr] ']' '=' Expr ';'
     else if  ( attemptMatch (variableName) ) {
 		VarName *var = new VarName(prevToken->lexeme);
+		int line = prevToken->line;
         if (attemptMatch ( leftSquare ) ) {
               
               ParseResult prExpr = parseExpr(0);
@@ -302,6 +360,9 @@ ParseResult Parser::parseStmt () {
               match ( comma ) ;
               ParseResult prExpr2 = parseExpr(0);
               Expr *expr2 = dynamic_cast<Expr *>(prExpr2.ast);
+              Expr *depth = NULL;
+              if (attemptMatch ( comma ) )
+                  depth = dynamic_cast<Expr *>(parseExpr(0).ast);
               
               match  ( rightSquare ) ;
               match(assign);
@@ -309,10 +370,23 @@ ParseResult Parser::parseStmt () {
 			  Expr *expr3 = dynamic_cast<Expr *>(prExpr3.ast);
 			
 			
-              pr.ast = new LongAssignStmt(var,expr1,expr2,expr3);
+              pr.ast = new LongAssignStmt(var,expr1,expr2,expr3,line,depth);
               match (semiColon);
             
         }
+        //Stmt ::= varName '(' Expr [',' Expr] ')' ';'   e.g. writeMatrix(m, "file")
+        else if (attemptMatch ( leftParen ) ) {
+            ParseResult prExpr = parseExpr(0);
+            Expr *expr1 = dynamic_cast<Expr *>(prExpr.ast);
+            Expr *expr2 = NULL;
+            if (attemptMatch ( comma ) ) {
+                ParseResult prExpr2 = parseExpr(0);
+                expr2 = dynamic_cast<Expr *>(prExpr2.ast);
+            }
+            match ( rightParen ) ;
+            match ( semiColon ) ;
+            pr.ast = new CallStmt(new NestOrFuncExpr(var, expr1, expr2, line));
+        }
         else {
 			//VarName *var = new VarName(prevToken->lexeme);
 			match(assign);
@@ -335,11 +409,27 @@ ParseResult Parser::parseStmt () {
 		pr.ast = new PrintStmt(expr1);
     }
     //Stmt ::= 'for' '(' varName '=' Expr ':' Expr ')' Stmt
+    //Stmt ::= 'for' '(' varName ',' varName ',' varName 'in' varName ')' Stmt
     else if ( attemptMatch (forKwd) ) {
+        int line = prevToken->line;
         match (leftParen) ;
         match (variableName) ;
         
         VarName *name = new VarName(prevToken->lexeme);
+        if ( attemptMatch (comma) ) {
+            match (variableName) ;
+            VarName *col = new VarName(prevToken->lexeme);
+            match (comma) ;
+            match (variableName) ;
+            VarName *value = new VarName(prevToken->lexeme);
+            match (inKwd) ;
+            match (variableName) ;
+            VarName *source = new VarName(prevToken->lexeme);
+            match (rightParen) ;
+            Stmt *stmt = dynamic_cast<Stmt *>(parseStmt().ast);
+            pr.ast = new SparseForStmt(name,col,value,source,stmt,line);
+            return pr ;
+        }
         
         match (assign) ;
         ParseResult prExpr = parseExpr(0);
@@ -357,6 +447,34 @@ ParseResult Parser::parseStmt () {
 		Stmt* stmt = dynamic_cast<Stmt *>(prStmt.ast);
         pr.ast = new ForStmt(name,expr1,expr2,stmt);
     }
+    //Stmt ::= 'parfor' '(' varName '=' Expr ':' Expr ')'
+    //         { 'reduce' '(' ('+' | '*' | 'max' | 'min') ':' varName ')' } Stmt
+    else if ( attemptMatch (parforKwd) ) {
+        int line = prevToken->line;
+        match (leftParen) ;
+        match (variableName) ;
+        VarName *name = new VarName(prevToken->lexeme);
+        match (assign) ;
+        Expr *expr1 = dynamic_cast<Expr *>(parseExpr(0).ast);
+        match (colon) ;
+        Expr *expr2 = dynamic_cast<Expr *>(parseExpr(0).ast);
+        match (rightParen) ;
+
+        vector<string> ops ;
+        vector<VarName *> vars ;
+        while ( attemptMatch (reduceKwd) ) {
+            match (leftParen) ;
+            ops.push_back(parseReductionOp("reduce")) ;
+            match (colon) ;
+            match (variableName) ;
+            vars.push_back(new VarName(prevToken->lexeme)) ;
+            match (rightParen) ;
+        }
+
+        ParseResult prStmt = parseStmt();
+        Stmt* stmt = dynamic_cast<Stmt *>(prStmt.ast);
+        pr.ast = new ParforStmt(name,expr1,expr2,ops,vars,stmt,line);
+    }
     //Stmt ::= 'while' '(' Expr ')' Stmt
     else if (attemptMatch(whileKwd)) {
         match(leftParen);
@@ -451,22 +569,33 @@ ParseResult Parser::parseVariableName ( ) {
     ParseResult pr ;
     match ( variableName ) ;
     std::string name(prevToken->lexeme);
+    int line = prevToken->line;
 	VarName *var = new VarName(name);
+    //! Expr ::= varableName '[' Expr ',' Expr [',' Expr] ']'
     if(attemptMatch(leftSquare)){
         ParseResult prExpr1 = parseExpr(0);
         match(comma);
         ParseResult prExpr2 = parseExpr(0);
+	Expr *depth = NULL;
+	if(attemptMatch(comma))
+	    depth = dynamic_cast<Expr *>(parseExpr(0).ast);
         match(rightSquare);
 	Expr *expr1 = dynamic_cast<Expr *>(prExpr1.ast);
 	Expr *expr2 = dynamic_cast<Expr *>(prExpr2.ast);
-	pr.ast = new MatrixRefExpr(var,expr1,expr2);
+	pr.ast = new MatrixRefExpr(var,expr1,expr2,line,depth);
     }
     //! Expr ::= varableName '(' Expr ')'        //NestedOrFunctionCall
+    //! Expr ::= varableName '(' Expr ',' Expr ')'   //e.g. matmul(a, b)
     else if(attemptMatch(leftParen)){
         ParseResult prExpr = parseExpr(0);
-        match(rightParen);
 	Expr *expr = dynamic_cast<Expr *>(prExpr.ast);
-	pr.ast = new NestOrFuncExpr(var,expr);
+	Expr *expr2 = NULL;
+        if(attemptMatch(comma)){
+            ParseResult prExpr2 = parseExpr(0);
+            expr2 = dynamic_cast<Expr *>(prExpr2.ast);
+        }
+        match(rightParen);
+	pr.ast = new NestOrFuncExpr(var,expr,expr2,line);
     }
     //! Expr := variableName
     else{
@@ -522,11 +651,89 @@ ParseResult Parser::parseLetExpr(){
    return pr;
 }
 
+//! Expr ::= 'map' '(' varName 'in' Expr ',' Expr ')'
+ParseResult Parser::parseMapExpr(){
+   ParseResult pr ;
+   match(mapKwd);
+   int line = prevToken->line;
+   match(leftParen);
+   match(variableName);
+   VarName *var = new VarName(prevToken->lexeme);
+   match(inKwd);
+   Expr *source = dynamic_cast<Expr *>(parseExpr(0).ast);
+   match(comma);
+   Expr *body = dynamic_cast<Expr *>(parseExpr(0).ast);
+   match(rightParen);
+   pr.ast = new MapExpr(var,source,body,line);
+   return pr;
+}
+
+//! Expr ::= 'filter' '(' varName 'in' Expr ',' Expr ')'
+ParseResult Parser::parseFilterExpr(){
+   ParseResult pr ;
+   match(filterKwd);
+   int line = prevToken->line;
+   match(leftParen);
+   match(variableName);
+   VarName *var = new VarName(prevToken->lexeme);
+   match(inKwd);
+   Expr *source = dynamic_cast<Expr *>(parseExpr(0).ast);
+   match(comma);
+   Expr *cond = dynamic_cast<Expr *>(parseExpr(0).ast);
+   match(rightParen);
+   pr.ast = new FilterExpr(var,source,cond,line);
+   return pr;
+}
+
+//! Expr ::= 'fold' '(' ( '+' | '*' | 'max' | 'min' ) ',' Expr [ ',' ( 'rows' | 'cols' ) ] ')'
+ParseResult Parser::parseFoldExpr(){
+   ParseResult pr ;
+   match(foldKwd);
+   int line = prevToken->line;
+   match(leftParen);
+   string op = parseReductionOp("fold") ;
+   match(comma);
+   Expr *source = dynamic_cast<Expr *>(parseExpr(0).ast);
+   string axis ;
+   if (attemptMatch(comma)) {
+       match(variableName);
+       axis = prevToken->lexeme ;
+       if (axis != "rows" && axis != "cols")
+           throw ( makeErrorMsg ( "fold folds along rows or cols" ) ) ;
+   }
+   match(rightParen);
+   pr.ast = new FoldExpr(op,source,axis,line);
+   return pr;
+}
+
+//! Expr ::= 'zip' '(' varName 'in' Expr ',' varName 'in' Expr ',' Expr ')'
+ParseResult Parser::parseZipExpr(){
+   ParseResult pr ;
+   match(zipKwd);
+   int line = prevToken->line;
+   match(leftParen);
+   match(variableName);
+   VarName *var1 = new VarName(prevToken->lexeme);
+   match(inKwd);
+   Expr *source1 = dynamic_cast<Expr *>(parseExpr(0).ast);
+   match(comma);
+   match(variableName);
+   VarName *var2 = new VarName(prevToken->lexeme);
+   match(inKwd);
+   Expr *source2 = dynamic_cast<Expr *>(parseExpr(0).ast);
+   match(comma);
+   Expr *body = dynamic_cast<Expr *>(parseExpr(0).ast);
+   match(rightParen);
+   pr.ast = new ZipExpr(var1,source1,var2,source2,body,line);
+   return pr;
+}
+
 //! Expr ::= '!' Expr 
 ParseResult Parser::parseNotExpr () {
     ParseResult pr ;
     match ( notOp ) ;
-    ParseResult prNot = parseExpr (0);
+    // ! applies to the operand next to it, as in C: ! a && b is (! a) && b.
+    ParseResult prNot = parseExpr (70);
     Expr *expr = dynamic_cast<Expr *>(prNot.ast);
     pr.ast = new NotExpr(expr);
     return pr ;
@@ -544,12 +751,13 @@ ParseResult Parser::parseAddition ( ParseResult prLeft ) {
 
   match ( plusSign ) ;
   string * op = new string(prevToken->lexeme);
+  int line = prevToken->line;
     
   ParseResult prRight = parseExpr( prevToken->lbp() ); 
   Expr *right = dynamic_cast<Expr *>(prRight.ast);
   //if(!right) throw((string) "Bad cast in right expr in parseAddition");
 
-  pr.ast = new BinOpExpr(left, op, right);
+  pr.ast = new BinOpExpr(left, op, right, line);
 
   return pr ;
 }
@@ -561,11 +769,12 @@ ParseResult Parser::parseMultiplication ( ParseResult prLeft ) {
   Expr *left = dynamic_cast<Expr *> (prLeft.ast);
   match ( star ) ;
   string* op = new string(prevToken->lexeme);
+  int line = prevToken->line;
   ParseResult prRight = parseExpr (prevToken->lbp());
   Expr *right = dynamic_cast<Expr *>(prRight.ast);
 
   //parseExpr( prevToken->lbp() );
-  pr.ast = new BinOpExpr (left, op,right); //////////////////the rest of the BinOps follow this as well. 
+  pr.ast = new BinOpExpr (left, op,right, line); //////////////////the rest of the BinOps follow this as well. 
   return pr ;
 }
 
@@ -576,11 +785,12 @@ ParseResult Parser::parseSubtraction ( ParseResult prLeft ) {
   Expr *left = dynamic_cast<Expr *> (prLeft.ast);
   match ( dash ) ;
   string* op = new string(prevToken->lexeme);
+  int line = prevToken->line;
   ParseResult prRight = parseExpr (prevToken->lbp());
   Expr *right = dynamic_cast<Expr *>(prRight.ast);
 
   //parseExpr( prevToken->lbp() );
-  pr.ast = new BinOpExpr (left, op,right); //////////////////the rest of the BinOps follow this as well. 
+  pr.ast = new BinOpExpr (left, op,right, line); //////////////////the rest of the BinOps follow this as well. 
   return pr ;
 }
 
@@ -591,9 +801,10 @@ ParseResult Parser::parseDivision ( ParseResult prLeft ) {
   Expr *left = dynamic_cast<Expr *> (prLeft.ast);
   match ( forwardSlash ) ;
   string* op = new string(prevToken->lexeme);
+  int line = prevToken->line;
   ParseResult prRight = parseExpr (prevToken->lbp());
   Expr *right = dynamic_cast<Expr *>(prRight.ast);
-  pr.ast = new BinOpExpr(left,op,right);
+  pr.ast = new BinOpExpr(left,op,right,line);
   return pr ;
 }
 
@@ -620,14 +831,30 @@ ParseResult Parser::parseRelationalExpr ( ParseResult prLeft ) {
     // just advance token, since examining it in parseExpr caused
     // this method being called.
     string* op = new string(prevToken->lexeme) ;
-    ParseResult prRight = parseExpr (currToken->lbp());
+    int line = prevToken->line;
+    // The right operand binds as tightly as the operator, so that
+    // a < b && c < d groups as (a < b) && (c < d).
+    ParseResult prRight = parseExpr (prevToken->lbp());
     
     Expr *right = dynamic_cast<Expr *>(prRight.ast);
-    pr.ast = new BinOpExpr(left,op,right);
+    pr.ast = new BinOpExpr(left,op,right,line);
    
     return pr ;
 }
 
+//! Expr ::= Expr '&&' Expr | Expr '||' Expr
+ParseResult Parser::parseLogicalExpr ( ParseResult prLeft ) {
+    ParseResult pr ;
+    Expr *left = dynamic_cast<Expr *>(prLeft.ast);
+    nextToken( ) ;
+    string* op = new string(prevToken->lexeme) ;
+    int line = prevToken->line;
+    ParseResult prRight = parseExpr (prevToken->lbp());
+    Expr *right = dynamic_cast<Expr *>(prRight.ast);
+    pr.ast = new BinOpExpr(left,op,right,line);
+    return pr ;
+}
+
 
 //! Helper function used by the parser.
 
@@ -694,3 +921,23 @@ string Parser::makeErrorMsg ( const char *msg ) {
     return msg ;
 }
 
+
+//! Parses the cell type of a typed Matrix: Float, Double, Int or Byte.
+string Parser::parseElementType () {
+    if (attemptMatch(floatKwd) || attemptMatch(doubleKwd) || attemptMatch(intKwd)
+        || attemptMatch(byteKwd))
+        return prevToken->lexeme ;
+    throw ( makeErrorMsg ( "Matrix cells are one of Float Double Int Byte" ) ) ;
+}
+
+//! Parses the operator of a fold or reduce clause: + * max min.
+string Parser::parseReductionOp ( const string &construct ) {
+    if (attemptMatch(plusSign) || attemptMatch(star))
+        return prevToken->lexeme ;
+    if (nextIs(variableName) && (currToken->lexeme == "max" || currToken->lexeme == "min")) {
+        string op = currToken->lexeme ;
+        nextToken() ;
+        return op ;
+    }
+    throw ( makeErrorMsg ( (construct + " takes one of + * max min").c_str() ) ) ;
+}
@@ -41,6 +41,10 @@ public:
     ParseResult parse (const char *text) ;
     
     void initialzeParser (const char* text);
+
+    // Releases the tokens of the previous input so the parser can be
+    // used again.  The scanner and its compiled regexes are kept.
+    void reset () ;
     // Parser methods for the nonterminals:
 
     ParseResult parseProgram () ;
@@ -62,12 +66,17 @@ public:
     ParseResult parseNotExpr();
     ParseResult parseLetExpr() ;
     ParseResult parseIfExpr() ;
+    ParseResult parseMapExpr() ;
+    ParseResult parseFilterExpr() ;
+    ParseResult parseFoldExpr() ;
+    ParseResult parseZipExpr() ;
     ParseResult parseAddition ( ParseResult left ) ;
     ParseResult parseMultiplication ( ParseResult left ) ;
     ParseResult parseSubtraction ( ParseResult left ) ;
     ParseResult parseDivision ( ParseResult left ) ;
 
     ParseResult parseRelationalExpr ( ParseResult left ) ;
+    ParseResult parseLogicalExpr ( ParseResult left ) ;
 
     // Helper function used by the parser.
     void match (tokenType tt) ;
@@ -79,6 +88,8 @@ public:
     std::string makeErrorMsg ( tokenType terminal ) ;
     std::string makeErrorMsgExpected ( tokenType terminal ) ;
     std::string makeErrorMsg ( const char *msg ) ;
+    std::string parseReductionOp ( const std::string &construct ) ;
+    std::string parseElementType ( ) ;
 
     ExtToken *tokens ;
     ExtToken *currToken ;
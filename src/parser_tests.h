@@ -28,6 +28,14 @@ public:
          TS_ASSERT(pr.ok);
     }
 
+    void test_cube_layouts ( ) {
+        ParseResult pr = p->parse ( "main(){Cube<FirstFastest> c [1, 2, 3] i, j, k = 0; Cube<LastFastest> d [1, 2, 3] = m;}" ) ;
+        TSM_ASSERT ( pr.errors, pr.ok ) ;
+        pr = p->parse ( "main(){Cube<Fastest> c [1, 1, 1] i, j, k = 0;}" ) ;
+        TS_ASSERT ( ! pr.ok ) ;
+        TS_ASSERT ( pr.errors.find ( "Cube layouts are one of LastFastest FirstFastest" ) != string::npos ) ;
+    }
+
     void test_parse_bad_syntax ( ) {
         const char *text 
           = readInputFromFile ( "../samples/bad_syntax_good_tokens.dsl" )  ;
@@ -109,4 +117,23 @@ public:
         TSM_ASSERT ( msg , pr.ok );
     }
 
+    void test_parser_reuse ( ) {
+        // One parser, several inputs back-to-back, including a failing one.
+        Parser reused ;
+        const char *files[] = { "../samples/sample_1.dsl",
+                                "../samples/bad_syntax_good_tokens.dsl",
+                                "../samples/forest_loss_v2.dsl",
+                                "../samples/sample_1.dsl" } ;
+        for (int i = 0; i < 4; i ++) {
+            const char *text = readInputFromFile ( files[i] ) ;
+            TS_ASSERT ( text ) ;
+            ParseResult pr = reused.parse ( text ) ;
+            TSM_ASSERT ( files[i], pr.ok == (i != 1) ) ;
+        }
+        reused.reset () ;
+        TS_ASSERT ( reused.tokens == NULL ) ;
+        TS_ASSERT ( reused.stokens == NULL ) ;
+        TS_ASSERT ( reused.s != NULL ) ;
+    }
+
 } ;
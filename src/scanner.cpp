@@ -19,11 +19,13 @@ Token::Token(tokenType inTerm, const char* text, int matchedChars, Token* inNext
  	newLex.assign(text,matchedChars);
 	lexeme = newLex;
 	next = inNext;
+	line = 0;
 }
 Token::Token(tokenType inTerm, std::string inLex, Token* inNext){
 	terminal = inTerm;
 	lexeme = inLex;
 	next = inNext;
+	line = 0;
 }
 
 Token::Token(const char* text, tokenType inTerm, Token* inNext){
@@ -32,12 +34,15 @@ Token::Token(const char* text, tokenType inTerm, Token* inNext){
 	newLex.assign(text);
 	lexeme = newLex;
 	next = inNext;
+	line = 0;
 }
 
 
 //Scanner constructor that loads all the regexes.
 Scanner::Scanner() {
 
+    freeTokens = NULL;
+
     //allocates memory for all the regexArrays
     regArray = new regex_t [endOfFile];    	
     //Constants: Begin
@@ -67,6 +72,11 @@ Scanner::Scanner() {
     regArray[floatKwd] = *makeRegex("^Float");
     regArray[stringKwd] = *makeRegex("^Str");
     regArray[matrixKwd] = *makeRegex("^Matrix");
+    regArray[maskKwd] = *makeRegex ("^Mask");
+    regArray[cubeKwd] = *makeRegex ("^Cube");
+    regArray[sparseKwd] = *makeRegex ("^Sparse");
+    regArray[doubleKwd] = *makeRegex ("^Double");
+    regArray[byteKwd] = *makeRegex ("^Byte");
     regArray[letKwd] = *makeRegex("^let");
     regArray[inKwd] = *makeRegex("^in");
     regArray[endKwd] = *makeRegex("^end");
@@ -76,6 +86,12 @@ Scanner::Scanner() {
     regArray[forKwd] = *makeRegex("^for");
     regArray[whileKwd] = *makeRegex("^while");
     regArray[printKwd] = *makeRegex("^print");
+    regArray[mapKwd] = *makeRegex("^map");
+    regArray[filterKwd] = *makeRegex("^filter");
+    regArray[foldKwd] = *makeRegex("^fold");
+    regArray[zipKwd] = *makeRegex("^zip");
+    regArray[parforKwd] = *makeRegex("^parfor");
+    regArray[reduceKwd] = *makeRegex("^reduce");
     regArray[assign] = *makeRegex("^=");
     regArray[plusSign] = *makeRegex("^\\+");	
     regArray[star] = *makeRegex("^\\*");
@@ -98,6 +114,56 @@ Scanner::Scanner() {
     filterArray[2] = *makeRegex ("^//[^\n]*\n");
 }
 
+//Scanner destructor, releases the compiled regexes and any recycled tokens.
+Scanner::~Scanner() {
+    for (int i = 0; i < endOfFile; i++)
+        regfree(&regArray[i]);
+    for (int i = 0; i < 3; i++)
+        regfree(&filterArray[i]);
+    delete [] regArray;
+    delete [] filterArray;
+
+    while (freeTokens != NULL) {
+        Token* temp = freeTokens;
+        freeTokens = freeTokens->next;
+        delete temp;
+    }
+}
+
+//Puts a whole token list on the free list so the next scan can reuse it.
+void Scanner::recycle(Token* list) {
+    while (list != NULL) {
+        Token* temp = list;
+        list = list->next;
+        temp->next = freeTokens;
+        freeTokens = temp;
+    }
+}
+
+//Takes a token from the free list, only allocating when it is empty.
+Token* Scanner::makeToken(tokenType term, const std::string& lex, int line) {
+    Token* temp;
+    if (freeTokens == NULL) {
+        temp = new Token(term, lex, NULL);
+    } else {
+        temp = freeTokens;
+        freeTokens = freeTokens->next;
+        temp->terminal = term;
+        temp->lexeme = lex;
+        temp->next = NULL;
+    }
+    temp->line = line;
+    return temp;
+}
+
+//Number of newlines in the first n characters of text.
+static int countLines(const char* text, int n) {
+    int lines = 0;
+    for (int i = 0; i < n; i++)
+        if (text[i] == '\n') lines++;
+    return lines;
+}
+
 int Scanner::consumeWhiteSpaceAndComments(regex_t *whiteSpace,
 								regex_t *blockComment,
 								regex_t *lineComment,
@@ -146,7 +212,9 @@ Token* Scanner::scan(const char* text){
     int numMatchedChars = 0;
 	
     //skip any initial whitespace
+    int line = 1;
     numMatchedChars = consumeWhiteSpaceAndComments(&filterArray[0], &filterArray[1], &filterArray[2], text);
+    line += countLines(text, numMatchedChars);
     text = text + numMatchedChars;
 
     //try matching with regexes
@@ -176,41 +244,28 @@ Token* Scanner::scan(const char* text){
 			maxNumMatchedChars = 1;
 		}
 		std::string lex (text, maxNumMatchedChars);
-		//set current node
-		Token* temp = new Token(term, lex, NULL);
-		temp->terminal = term;
-		temp->lexeme = lex;
-		temp->next = NULL;
+		//set current node, keeping a tail pointer so appending stays O(1)
+		Token* temp = makeToken(term, lex, line);
 		if(head==NULL){
 			head = temp;
 		}
 		else{
-		  tail = head;
-		  while(tail->next!=NULL){
-		    tail = tail->next;
-		  }
 		  tail->next = temp;
 		}
+		tail = temp;
+		line += countLines(text, maxNumMatchedChars);
 		text = text + maxNumMatchedChars;
 		numMatchedChars = consumeWhiteSpaceAndComments(&filterArray[0], &filterArray[1], &filterArray[2], text);
+		line += countLines(text, numMatchedChars);
 		text = text + numMatchedChars;
 	}
 	//set end of file node
-	std::string lex;
-	Token* temp = new Token(endOfFile, lex, NULL);
-	temp->terminal = endOfFile;
-	temp->lexeme = lex;
-	temp->next = NULL;
+	Token* temp = makeToken(endOfFile, std::string(), line);
 	if(head==NULL){
 		head = temp;
 	}
 	else{
-		tail = head;
-    while(tail->next!=NULL){
-    tail = tail->next;
-    }
-			tail->next = temp;
-	
+		tail->next = temp;
 	}
 	return head;
 }
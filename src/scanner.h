@@ -12,9 +12,12 @@ construct was matched.
 enum tokenEnumType {
 
         intKwd, floatKwd, boolKwd, 
-        trueKwd, falseKwd, stringKwd, matrixKwd,
+        trueKwd, falseKwd, stringKwd, matrixKwd, maskKwd, cubeKwd, sparseKwd,
+        doubleKwd, byteKwd,
 	letKwd, inKwd, endKwd, ifKwd, thenKwd, elseKwd,
 	forKwd, whileKwd, printKwd,
+	mapKwd, filterKwd, foldKwd, zipKwd,
+	parforKwd, reduceKwd,
 
 	// Constants
 	intConst, floatConst, stringConst,
@@ -49,6 +52,7 @@ class Token { //Can add more fields later
 	tokenType terminal;
 	std::string lexeme;
 	Token* next;
+	int line; // source line the token starts on, 0 if unknown
   	Token(tokenType, const char*, int, Token*);
 	Token(tokenType, std::string, Token*);
 	Token();
@@ -68,8 +72,15 @@ class Scanner {
      regex_t* regArray;
      regex_t* filterArray;
      Scanner();
+     ~Scanner();
      int consumeWhiteSpaceAndComments(regex_t*, regex_t*, regex_t*, const char*);
      Token* scan(const char*); 
+     // Hands a token list produced by scan back so later scans can reuse it.
+     void recycle(Token*);
+    private:
+     Token* freeTokens; // tokens returned by recycle, reused by scan
+     Token* makeToken(tokenType, const std::string&, int);
+     Scanner(const Scanner &) {};
 };
 
 int consumeWhiteSpaceAndComments(regex_t *whiteSpace,regex_t *blockComment, regex_t *lineComment,const char *text);
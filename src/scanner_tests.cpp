@@ -0,0 +1,411 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#define _CXXTEST_HAVE_EH
+#define _CXXTEST_ABORT_TEST_ON_FAIL
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/TestMain.h>
+#include <cxxtest/ErrorPrinter.h>
+
+int main( int argc, char *argv[] ) {
+ int status;
+    CxxTest::ErrorPrinter tmp;
+    CxxTest::RealWorldDescription::_worldName = "cxxtest";
+    status = CxxTest::Main< CxxTest::ErrorPrinter >( tmp, argc, argv );
+    return status;
+}
+bool suite_ScannerTestSuite_init = false;
+#include "/root/repo/src/scanner_tests.h"
+
+static ScannerTestSuite suite_ScannerTestSuite;
+
+static CxxTest::List Tests_ScannerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ScannerTestSuite( "scanner_tests.h", 8, "ScannerTestSuite", suite_ScannerTestSuite, Tests_ScannerTestSuite );
+
+static class TestDescription_suite_ScannerTestSuite_test_setup_code : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_setup_code() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 17, "test_setup_code" ) {}
+ void runTest() { suite_ScannerTestSuite.test_setup_code(); }
+} testDescription_suite_ScannerTestSuite_test_setup_code;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_empty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_empty() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 136, "test_scan_empty" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_empty(); }
+} testDescription_suite_ScannerTestSuite_test_scan_empty;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_empty_comment : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_empty_comment() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 143, "test_scan_empty_comment" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_empty_comment(); }
+} testDescription_suite_ScannerTestSuite_test_scan_empty_comment;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_lexicalErrors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_lexicalErrors() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 152, "test_scan_lexicalErrors" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_lexicalErrors(); }
+} testDescription_suite_ScannerTestSuite_test_scan_lexicalErrors;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_nums_vars : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_nums_vars() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 173, "test_scan_nums_vars" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_nums_vars(); }
+} testDescription_suite_ScannerTestSuite_test_scan_nums_vars;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_bad_syntax_good_tokens : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_bad_syntax_good_tokens() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 187, "test_scan_bad_syntax_good_tokens" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_bad_syntax_good_tokens(); }
+} testDescription_suite_ScannerTestSuite_test_scan_bad_syntax_good_tokens;
+
+static class TestDescription_suite_ScannerTestSuite_test_scan_sample_forestLoss_v2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_scan_sample_forestLoss_v2() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 226, "test_scan_sample_forestLoss_v2" ) {}
+ void runTest() { suite_ScannerTestSuite.test_scan_sample_forestLoss_v2(); }
+} testDescription_suite_ScannerTestSuite_test_scan_sample_forestLoss_v2;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_intKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_intKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 237, "test_terminal_intKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_intKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_intKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_floatKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_floatKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 239, "test_terminal_floatKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_floatKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_floatKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_stringKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_stringKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 241, "test_terminal_stringKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_stringKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_stringKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_boolKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_boolKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 243, "test_terminal_boolKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_boolKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_boolKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_trueKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_trueKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 245, "test_terminal_trueKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_trueKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_trueKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_falseKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_falseKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 247, "test_terminal_falseKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_falseKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_falseKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_matrixKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_matrixKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 249, "test_terminal_matrixKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_matrixKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_matrixKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_maskKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_maskKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 250, "test_terminal_maskKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_maskKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_maskKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_cubeKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_cubeKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 251, "test_terminal_cubeKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_cubeKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_cubeKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_sparseKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_sparseKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 252, "test_terminal_sparseKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_sparseKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_sparseKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_doubleKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_doubleKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 253, "test_terminal_doubleKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_doubleKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_doubleKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_byteKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_byteKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 254, "test_terminal_byteKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_byteKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_byteKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_letKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_letKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 256, "test_terminal_letKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_letKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_letKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_inKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_inKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 258, "test_terminal_inKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_inKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_inKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_endKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_endKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 260, "test_terminal_endKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_endKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_endKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_ifKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_ifKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 262, "test_terminal_ifKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_ifKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_ifKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_thenKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_thenKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 264, "test_terminal_thenKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_thenKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_thenKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_elseKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_elseKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 266, "test_terminal_elseKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_elseKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_elseKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_forKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_forKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 268, "test_terminal_forKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_forKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_forKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_whileKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_whileKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 270, "test_terminal_whileKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_whileKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_whileKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_printKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_printKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 272, "test_terminal_printKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_printKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_printKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_mapKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_mapKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 273, "test_terminal_mapKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_mapKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_mapKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_filterKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_filterKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 274, "test_terminal_filterKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_filterKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_filterKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_foldKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_foldKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 275, "test_terminal_foldKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_foldKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_foldKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_zipKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_zipKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 276, "test_terminal_zipKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_zipKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_zipKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_parforKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_parforKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 277, "test_terminal_parforKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_parforKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_parforKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_reduceKwd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_reduceKwd() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 278, "test_terminal_reduceKwd" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_reduceKwd(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_reduceKwd;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_intConst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_intConst() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 280, "test_terminal_intConst" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_intConst(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_intConst;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_floatConst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_floatConst() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 282, "test_terminal_floatConst" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_floatConst(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_floatConst;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_stringConst : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_stringConst() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 284, "test_terminal_stringConst" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_stringConst(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_stringConst;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_variableName : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_variableName() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 286, "test_terminal_variableName" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_variableName(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_variableName;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_leftParen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_leftParen() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 288, "test_terminal_leftParen" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_leftParen(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_leftParen;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_rightParen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_rightParen() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 290, "test_terminal_rightParen" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_rightParen(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_rightParen;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_leftCurly : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_leftCurly() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 292, "test_terminal_leftCurly" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_leftCurly(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_leftCurly;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_rightCurly : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_rightCurly() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 294, "test_terminal_rightCurly" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_rightCurly(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_rightCurly;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_leftSquare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_leftSquare() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 296, "test_terminal_leftSquare" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_leftSquare(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_leftSquare;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_rightSquare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_rightSquare() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 298, "test_terminal_rightSquare" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_rightSquare(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_rightSquare;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_comma : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_comma() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 300, "test_terminal_comma" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_comma(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_comma;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_semiColon : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_semiColon() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 302, "test_terminal_semiColon" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_semiColon(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_semiColon;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_colon : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_colon() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 304, "test_terminal_colon" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_colon(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_colon;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_assign() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 306, "test_terminal_assign" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_assign(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_assign;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_plusSign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_plusSign() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 308, "test_terminal_plusSign" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_plusSign(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_plusSign;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_star : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_star() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 310, "test_terminal_star" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_star(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_star;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_dash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_dash() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 312, "test_terminal_dash" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_dash(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_dash;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_forwadrSlash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_forwadrSlash() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 314, "test_terminal_forwadrSlash" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_forwadrSlash(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_forwadrSlash;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_lessThan : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_lessThan() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 316, "test_terminal_lessThan" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_lessThan(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_lessThan;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_lessThanEqual : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_lessThanEqual() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 318, "test_terminal_lessThanEqual" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_lessThanEqual(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_lessThanEqual;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_greaterThan : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_greaterThan() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 320, "test_terminal_greaterThan" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_greaterThan(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_greaterThan;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_greaterThanEqual : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_greaterThanEqual() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 322, "test_terminal_greaterThanEqual" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_greaterThanEqual(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_greaterThanEqual;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_equalsEquals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_equalsEquals() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 324, "test_terminal_equalsEquals" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_equalsEquals(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_equalsEquals;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_notEquals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_notEquals() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 326, "test_terminal_notEquals" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_notEquals(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_notEquals;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_andOp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_andOp() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 328, "test_terminal_andOp" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_andOp(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_andOp;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_orOp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_orOp() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 330, "test_terminal_orOp" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_orOp(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_orOp;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_notOp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_notOp() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 332, "test_terminal_notOp" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_notOp(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_notOp;
+
+static class TestDescription_suite_ScannerTestSuite_test_terminal_endOfFile : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_terminal_endOfFile() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 334, "test_terminal_endOfFile" ) {}
+ void runTest() { suite_ScannerTestSuite.test_terminal_endOfFile(); }
+} testDescription_suite_ScannerTestSuite_test_terminal_endOfFile;
+
+static class TestDescription_suite_ScannerTestSuite_test_token_lines : public CxxTest::RealTestDescription {
+public:
+ TestDescription_suite_ScannerTestSuite_test_token_lines() : CxxTest::RealTestDescription( Tests_ScannerTestSuite, suiteDescription_ScannerTestSuite, 339, "test_token_lines" ) {}
+ void runTest() { suite_ScannerTestSuite.test_token_lines(); }
+} testDescription_suite_ScannerTestSuite_test_token_lines;
+
+#include <cxxtest/Root.cpp>
+const char* CxxTest::RealWorldDescription::_worldName = "cxxtest";
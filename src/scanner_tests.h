@@ -247,6 +247,11 @@ class ScannerTestSuite : public CxxTest::TestSuite
   void test_terminal_falseKwd () { compare_terminals("  False", falseKwd);}
 
   void test_terminal_matrixKwd () { compare_terminals("  Matrix", matrixKwd);}
+  void test_terminal_maskKwd () { compare_terminals("  Mask", maskKwd);}
+  void test_terminal_cubeKwd () { compare_terminals("  Cube", cubeKwd);}
+  void test_terminal_sparseKwd () { compare_terminals("  Sparse", sparseKwd);}
+  void test_terminal_doubleKwd () { compare_terminals("  Double", doubleKwd);}
+  void test_terminal_byteKwd () { compare_terminals("  Byte", byteKwd);}
 
   void test_terminal_letKwd () { compare_terminals("  let", letKwd);}
 
@@ -265,6 +270,12 @@ class ScannerTestSuite : public CxxTest::TestSuite
   void test_terminal_whileKwd () { compare_terminals("  while", whileKwd);}
 
   void test_terminal_printKwd () { compare_terminals("  print", printKwd);}
+  void test_terminal_mapKwd () { compare_terminals("  map", mapKwd);}
+  void test_terminal_filterKwd () { compare_terminals("  filter", filterKwd);}
+  void test_terminal_foldKwd () { compare_terminals("  fold", foldKwd);}
+  void test_terminal_zipKwd () { compare_terminals("  zip", zipKwd);}
+  void test_terminal_parforKwd () { compare_terminals("  parfor", parforKwd);}
+  void test_terminal_reduceKwd () { compare_terminals("  reduce", reduceKwd);}
 
   void test_terminal_intConst () { compare_terminals("  123", intConst);}
 
@@ -322,4 +333,16 @@ class ScannerTestSuite : public CxxTest::TestSuite
 
   void test_terminal_endOfFile () { compare_terminals("  ", endOfFile);}
 
+  /* Tokens record the line they start on; newlines in comments and
+     white space both count.
+  */
+  void test_token_lines ( ) {
+    Token *tks = s->scan ("main ( ) {\n  // a comment\n  Int x ;\n /* a\n b */ x = 1 ; }") ;
+    int lines[] = { 1, 1, 1, 1, 3, 3, 3, 5, 5, 5, 5, 5, 5 } ;
+    Token *t = tks ;
+    for (int i = 0; i < 13 && t != NULL; i ++, t = t->next) {
+      TS_ASSERT_EQUALS ( t->line, lines[i] ) ;
+    }
+  }
+
 } ;
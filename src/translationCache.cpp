@@ -0,0 +1,196 @@
+/*! \file translationCache.cpp
+    \brief Implementation of the on-disk translation and binary cache.
+*/
+
+#include "translationCache.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <dirent.h>
+#include <utime.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+
+using namespace std ;
+
+//! Reads a whole file into text, returns false if it cannot be opened.
+static bool readWholeFile (const string &path, string &text) {
+    ifstream in (path.c_str(), ios::in | ios::binary) ;
+    if (!in) return false ;
+    ostringstream buf ;
+    buf << in.rdbuf() ;
+    text = buf.str() ;
+    return true ;
+}
+
+//! Writes text to path through a temporary file so that readers in
+//! other processes never see a half written entry.  The temporary file
+//! gets a name of its own, so that several processes can write the same
+//! entry at once.
+static bool writeWholeFile (const string &path, const string &text) {
+    vector<char> tmp (path.begin(), path.end()) ;
+    const char suffix[] = ".XXXXXX" ;
+    tmp.insert (tmp.end(), suffix, suffix + sizeof(suffix)) ;
+    int fd = mkstemp (&tmp[0]) ;
+    if (fd < 0) return false ;
+    fchmod (fd, 0644) ;
+    size_t done = 0 ;
+    while (done < text.size()) {
+        ssize_t n = write (fd, text.data() + done, text.size() - done) ;
+        if (n <= 0) break ;
+        done += n ;
+    }
+    if (close (fd) != 0 || done < text.size()
+        || rename (&tmp[0], path.c_str()) != 0) {
+        unlink (&tmp[0]) ;
+        return false ;
+    }
+    return true ;
+}
+
+string hashString (const string &text) {
+    unsigned long long h = 14695981039346656037ULL ;
+    for (size_t i = 0; i < text.size(); i ++) {
+        h ^= (unsigned char) text[i] ;
+        h *= 1099511628211ULL ;
+    }
+    char buf[17] ;
+    snprintf (buf, sizeof(buf), "%016llx", h) ;
+    return buf ;
+}
+
+TranslationCache::TranslationCache (const string &_dir, long _maxBytes,
+                                    const string &runtimeDir)
+    : cppHits(0), cppMisses(0), binaryHits(0), binaryMisses(0),
+      evictions(0), dir(_dir), maxBytes(_maxBytes) {
+    mkdir (dir.c_str(), 0755) ;
+
+    string prologue, header, source ;
+    readWholeFile (runtimeDir + "/fcalrt.h", prologue) ;
+    readWholeFile (runtimeDir + "/Matrix.h", header) ;
+    readWholeFile (runtimeDir + "/Matrix.cpp", source) ;
+    runtimeHash = hashString (prologue + '\0' + header + '\0' + source) ;
+
+    string translator ;
+    if (readWholeFile ("/proc/self/exe", translator))
+        translatorHash = hashString (translator) ;
+    else
+        translatorHash = __DATE__ " " __TIME__ ;
+}
+
+string TranslationCache::cppKey (const string &source, const string &options) {
+    return hashString (source + '\0' + options + '\0' + runtimeHash + '\0' + translatorHash) ;
+}
+
+string TranslationCache::binaryKey (const string &cpp, const string &command) {
+    return hashString (cpp + '\0' + command + '\0' + runtimeHash + '\0' + translatorHash) ;
+}
+
+string TranslationCache::entryPath (const string &key, const char *ext) {
+    return dir + "/" + key + ext ;
+}
+
+bool TranslationCache::fetchCpp (const string &key, string &cpp) {
+    string path = entryPath (key, ".cpp") ;
+    if (!readWholeFile (path, cpp)) {
+        cppMisses ++ ;
+        return false ;
+    }
+    utime (path.c_str(), NULL) ; // mark as recently used
+    cppHits ++ ;
+    return true ;
+}
+
+void TranslationCache::storeCpp (const string &key, const string &cpp) {
+    writeWholeFile (entryPath (key, ".cpp"), cpp) ;
+    evict () ;
+}
+
+bool TranslationCache::fetchBinary (const string &key, const string &exe) {
+    string path = entryPath (key, ".bin") ;
+    string bytes ;
+    if (!readWholeFile (path, bytes) || !writeWholeFile (exe, bytes)) {
+        binaryMisses ++ ;
+        return false ;
+    }
+    chmod (exe.c_str(), 0755) ;
+    utime (path.c_str(), NULL) ;
+    binaryHits ++ ;
+    return true ;
+}
+
+void TranslationCache::storeBinary (const string &key, const string &exe) {
+    string bytes ;
+    if (!readWholeFile (exe, bytes)) return ;
+    writeWholeFile (entryPath (key, ".bin"), bytes) ;
+    evict () ;
+}
+
+//! A cache file together with its size and last use time.
+struct CacheEntry {
+    string path ;
+    long bytes ;
+    long long used ; //! modification time in nanoseconds
+    bool operator< (const CacheEntry &other) const { return used < other.used ; }
+} ;
+
+//! Lists the cache entries found in dir.
+static vector<CacheEntry> listEntries (const string &dir) {
+    vector<CacheEntry> entries ;
+    DIR *d = opendir (dir.c_str()) ;
+    if (d == NULL) return entries ;
+    struct dirent *e ;
+    while ((e = readdir (d)) != NULL) {
+        string name (e->d_name) ;
+        if (name.size() < 4) continue ;
+        string ext = name.substr (name.size() - 4) ;
+        if (ext != ".cpp" && ext != ".bin") continue ;
+        CacheEntry entry ;
+        entry.path = dir + "/" + name ;
+        struct stat st ;
+        if (stat (entry.path.c_str(), &st) != 0) continue ;
+        entry.bytes = st.st_size ;
+        entry.used = st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec ;
+        entries.push_back (entry) ;
+    }
+    closedir (d) ;
+    return entries ;
+}
+
+long TranslationCache::size () {
+    vector<CacheEntry> entries = listEntries (dir) ;
+    long total = 0 ;
+    for (size_t i = 0; i < entries.size(); i ++)
+        total += entries[i].bytes ;
+    return total ;
+}
+
+void TranslationCache::evict () {
+    vector<CacheEntry> entries = listEntries (dir) ;
+    long total = 0 ;
+    for (size_t i = 0; i < entries.size(); i ++)
+        total += entries[i].bytes ;
+    if (total <= maxBytes) return ;
+
+    stable_sort (entries.begin(), entries.end()) ;
+    for (size_t i = 0; i < entries.size() && total > maxBytes; i ++) {
+        if (remove (entries[i].path.c_str()) == 0) {
+            total -= entries[i].bytes ;
+            evictions ++ ;
+        }
+    }
+}
+
+string TranslationCache::stats () {
+    ostringstream out ;
+    out << "cpp hits " << cppHits << ", misses " << cppMisses
+        << "; binary hits " << binaryHits << ", misses " << binaryMisses
+        << "; evictions " << evictions << "; " << size() << " bytes" ;
+    return out.str() ;
+}
@@ -0,0 +1,69 @@
+/*! \file translationCache.h
+    \brief A persistent, size-bounded on-disk cache of generated C++
+    code and of the binaries compiled from it.
+
+    Entries are plain files in one directory, named after a 64-bit
+    hash.  Generated code is keyed by the FCAL source, the translator
+    options and the Matrix runtime; binaries are keyed by the C++ text,
+    the compile command and the Matrix runtime.  Both keys also include
+    a hash of the running translator, so a rebuilt translator does not
+    reuse the translations of an older one.  When the directory
+    grows past its size bound the least recently used entries are
+    removed.
+*/
+
+#ifndef TRANSLATION_CACHE_H
+#define TRANSLATION_CACHE_H
+
+#include <string>
+
+class TranslationCache {
+public:
+    //! \param _dir directory holding the entries, created if missing
+    //! \param _maxBytes upper bound on the total size of the entries
+    //! \param runtimeDir directory containing fcalrt.h, Matrix.h and Matrix.cpp
+    TranslationCache (const std::string &_dir, long _maxBytes,
+                      const std::string &runtimeDir) ;
+
+    //! Key for the C++ translation of an FCAL program.
+    std::string cppKey (const std::string &source, const std::string &options) ;
+    //! Key for the binary compiled from generated C++ code.
+    std::string binaryKey (const std::string &cpp, const std::string &command) ;
+
+    //! Fills cpp and returns true when the key is cached.
+    bool fetchCpp (const std::string &key, std::string &cpp) ;
+    void storeCpp (const std::string &key, const std::string &cpp) ;
+
+    //! Copies the cached binary to exe and returns true when the key is cached.
+    bool fetchBinary (const std::string &key, const std::string &exe) ;
+    void storeBinary (const std::string &key, const std::string &exe) ;
+
+    //! Removes least recently used entries until the cache fits maxBytes.
+    void evict () ;
+    //! Total size in bytes of all entries currently on disk.
+    long size () ;
+
+    //! One line summary of the hit/miss counters.
+    std::string stats () ;
+
+    int cppHits, cppMisses ;
+    int binaryHits, binaryMisses ;
+    int evictions ;
+
+    //! Hash of the translator binary running this cache, read from
+    //! /proc/self/exe; part of every key.
+    std::string translatorHash ;
+
+private:
+    std::string dir ;
+    long maxBytes ;
+    std::string runtimeHash ; //! hash of the Matrix runtime sources
+
+    std::string entryPath (const std::string &key, const char *ext) ;
+    TranslationCache (const TranslationCache &) {} ;
+} ;
+
+//! 64-bit FNV-1a hash of text, as 16 hex digits.
+std::string hashString (const std::string &text) ;
+
+#endif /* TRANSLATION_CACHE_H */
@@ -0,0 +1,129 @@
+/*! \file translator.cpp
+    \brief Implementation of the Translator: FCAL file to C++ to binary.
+*/
+
+#include "translator.h"
+#include "readInput.h"
+
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <vector>
+
+using namespace std ;
+
+Translator::Translator ()
+    : runtimeDir("../samples"), libraryDir("."), compileFlags("-O2"), cache(NULL) { }
+
+Translator::~Translator () {
+    if (cache) delete cache ;
+}
+
+void Translator::useCache (const string &dir, long maxBytes) {
+    if (cache) delete cache ;
+    cache = new TranslationCache (dir, maxBytes, runtimeDir) ;
+}
+
+//! Deletes the AST under root, each node once; Node destructors do not
+//! delete their children.
+static void deleteTree (Node *root) {
+    set<Node *> nodes ;
+    vector<Node *> work (1, root) ;
+    while (!work.empty()) {
+        Node *n = work.back() ;
+        work.pop_back() ;
+        if (n == NULL || !nodes.insert (n).second) continue ;
+        n->children (work) ;
+    }
+    for (set<Node *>::iterator i = nodes.begin(); i != nodes.end(); i ++)
+        delete *i ;
+}
+
+bool Translator::translate (const string &dslFile, string &cpp) {
+    char *text = readInputFromFile (dslFile.c_str()) ;
+    if (text == NULL) {
+        errors = "Cannot read " + dslFile ;
+        return false ;
+    }
+    string source (text) ;
+    free (text) ;
+
+    string key ;
+    if (cache) {
+        key = cache->cppKey (source, options.signature()) ;
+        if (cache->fetchCpp (key, cpp)) return true ;
+    }
+
+    ParseResult pr = p.parse (source.c_str()) ;
+    if (!pr.ok) {
+        errors = pr.errors ;
+        deleteTree (pr.ast) ;
+        return false ;
+    }
+    Node::options = options ;
+    cpp = pr.ast->cppCode () ;
+    Node::options = CodeGenOptions () ;
+    deleteTree (pr.ast) ;
+    if (!Node::facts.errors.empty()) {
+        errors = "" ;
+        for (size_t i = 0; i < Node::facts.errors.size(); i ++)
+            errors += (i > 0 ? "\n" : "") + Node::facts.errors[i] ;
+        return false ;
+    }
+
+    if (cache) cache->storeCpp (key, cpp) ;
+    return true ;
+}
+
+//! Modification time of path, or 0 if it does not exist.
+static long long modified (const string &path) {
+    struct stat st ;
+    if (stat (path.c_str(), &st) != 0) return 0 ;
+    return st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec ;
+}
+
+bool Translator::libraryCurrent () {
+    long long lib = modified (libraryDir + "/libfcalrt.a") ;
+    return lib != 0 && lib >= modified (runtimeDir + "/Matrix.cpp")
+        && lib >= modified (runtimeDir + "/Matrix.h") ;
+}
+
+void Translator::refreshLibrary () {
+    string lib = libraryDir + "/libfcalrt.a" ;
+    if (modified (lib) == 0 || libraryCurrent ()) return ;
+    string object = libraryDir + "/Matrix.o" ;
+    string command = "g++ " + compileFlags + " -Wall -fPIC -c " + runtimeDir + "/Matrix.cpp -o "
+        + object + " && rm -f " + lib + " && ar rcs " + lib + " " + object ;
+    if (system (command.c_str()) != 0)
+        cerr << "could not rebuild " << lib << ", compiling Matrix.cpp instead" << endl ;
+}
+
+string Translator::compileCommand (const string &cppFile, const string &exe) {
+    string lib = libraryDir + "/libfcalrt.a" ;
+    if (!libraryCurrent ())
+        lib = runtimeDir + "/Matrix.cpp" ;
+    return "g++ " + compileFlags + " -I" + runtimeDir + " " + cppFile + " " +
+           lib + " -o " + exe ;
+}
+
+int Translator::compile (const string &cppFile, const string &exe) {
+    string command = compileCommand (cppFile, exe) ;
+
+    string key ;
+    if (cache) {
+        ifstream in (cppFile.c_str()) ;
+        ostringstream cpp ;
+        cpp << in.rdbuf() ;
+        // the file names do not affect the binary, so keep them out of the key
+        key = cache->binaryKey (cpp.str(), compileCommand ("<cpp>", "<exe>")) ;
+        if (cache->fetchBinary (key, exe)) return 0 ;
+    }
+
+    int rc = system (command.c_str()) ;
+
+    if (cache && rc == 0) cache->storeBinary (key, exe) ;
+    return rc ;
+}
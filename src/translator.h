@@ -0,0 +1,59 @@
+/*! \file translator.h
+    \brief Ties the parser, the C++ code generation and the native
+    compile step together, short-circuiting both through a
+    TranslationCache when one is attached.
+*/
+
+#ifndef TRANSLATOR_H
+#define TRANSLATOR_H
+
+#include "parser.h"
+#include "translationCache.h"
+
+#include <string>
+
+class Translator {
+public:
+    Translator () ;
+    ~Translator () ;
+
+    //! Attaches a cache in dir holding at most maxBytes of entries.
+    void useCache (const std::string &dir, long maxBytes) ;
+
+    //! Translates the FCAL program in dslFile into cpp.
+    //! \return false, with the reason in errors, if it does not parse or
+    //! does not type check.
+    bool translate (const std::string &dslFile, std::string &cpp) ;
+
+    //! Compiles cppFile against the Matrix runtime into exe, linking
+    //! libfcalrt.a from libraryDir when it is current and compiling
+    //! Matrix.cpp from source otherwise.
+    //! \return the exit status of the compiler, 0 on success.
+    int compile (const std::string &cppFile, const std::string &exe) ;
+
+    //! Rebuilds an existing libfcalrt.a that is older than Matrix.cpp or
+    //! Matrix.h.  It writes the library in place, so call it once before
+    //! compiling, not from several processes at a time.
+    void refreshLibrary () ;
+
+    //! The compiler command line used for cppFile and exe.
+    std::string compileCommand (const std::string &cppFile,
+                                const std::string &exe) ;
+
+    CodeGenOptions options ; //! code generation options, part of the cache key
+    std::string runtimeDir ; //! directory holding fcalrt.h, Matrix.h and Matrix.cpp
+    std::string libraryDir ; //! directory holding libfcalrt.a
+    //! Flags for the compiler; must match RT_FLAGS in the Makefile for
+    //! the precompiled fcalrt.h to be used.
+    std::string compileFlags ;
+    std::string errors ;
+    TranslationCache *cache ;
+
+private:
+    //! True if libfcalrt.a exists and is newer than the runtime sources.
+    bool libraryCurrent () ;
+    Parser p ;
+    Translator (const Translator &) {} ;
+} ;
+
+#endif /* TRANSLATOR_H */